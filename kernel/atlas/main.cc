@@ -0,0 +1,204 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file main.cc
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "SOIL2/SOIL2.h"
+#include "rapidjson/document.h"
+#include "rapidjson/prettywriter.h"
+#include "rapidjson/stringbuffer.h"
+
+/**
+ * Image waiting for packing.
+ */
+struct Image {
+    std::string name;
+    int width, height;
+    unsigned char* data;
+    int page, x, y;
+};
+
+/**
+ * Empty border around each image. Border pixels are repeated into it so that
+ * linear filtering never samples the neighbours.
+ */
+constexpr int PADDING = 1;
+
+/**
+ * Place images onto pages row by row, tallest first.
+ * @param images: images to be packed
+ * @param page_size: width and height of pages
+ * @return int, the number of pages
+ */
+int pack(std::vector<Image>& images, const int& page_size) {
+    std::sort(images.begin(), images.end(), [](const Image& a, const Image& b) {
+        return a.height > b.height;
+    });
+
+    int pages = 0, x = 0, y = 0, row_height = 0;
+    for (auto& image : images) {
+        int width = image.width + PADDING * 2, height = image.height + PADDING * 2;
+        if (pages == 0) {
+            pages = 1;
+        }
+
+        if (x + width > page_size) {
+            x = 0; y += row_height; row_height = 0;
+        }
+        if (y + height > page_size) {
+            x = 0; y = 0; row_height = 0;
+            pages++;
+        }
+
+        image.page = pages - 1;
+        image.x = x + PADDING; image.y = y + PADDING;
+        x += width;
+        row_height = std::max(row_height, height);
+    }
+
+    return pages;
+}
+
+/**
+ * Copy an image into the page, and repeat its border pixels into padding.
+ * @param page: pixels of page in RGBA
+ * @param page_size: width and height of page
+ * @param image: the image to be copied
+ */
+void blit(std::vector<unsigned char>& page, const int& page_size, const Image& image) {
+    for (int dy = -PADDING; dy < image.height + PADDING; dy++) {
+        int sy = std::clamp(dy, 0, image.height - 1);
+        for (int dx = -PADDING; dx < image.width + PADDING; dx++) {
+            int sx = std::clamp(dx, 0, image.width - 1);
+            std::memcpy(&page[((image.y + dy) * page_size + image.x + dx) * 4],
+                        &image.data[(sy * image.width + sx) * 4], 4);
+        }
+    }
+}
+
+/**
+ * Pack PNG images into atlas pages.
+ * Usage: atlas <image directory> <index file> [page size]
+ * Pages are written into the atlas directory under image directory, and the index maps
+ * image names to their pages and sub-rectangles. Images larger than a page are left alone.
+ */
+int main(int argc, char* argv[]) {
+    if (argc != 3 && argc != 4) {
+        printf("usage: atlas <image directory> <index file> [page size]\n");
+        return 0;
+    }
+
+    std::filesystem::path root = argv[1];
+    std::string index = argv[2];
+    int page_size = (argc == 4) ? std::stoi(argv[3]) : 2048;
+    const std::string ATLAS_DIRECTORY = "atlas";
+
+    std::vector<Image> images;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+        auto relative = std::filesystem::relative(entry.path(), root);
+        if (!entry.is_regular_file() || entry.path().extension() != ".png" ||
+            *relative.begin() == ATLAS_DIRECTORY) {
+            continue;
+        }
+
+        Image image{relative.generic_string(), 0, 0, nullptr, 0, 0, 0};
+        image.data = SOIL_load_image(entry.path().string().c_str(), &image.width, &image.height,
+                                     nullptr, SOIL_LOAD_RGBA);
+        if (image.data == nullptr) {
+            printf("can't load %s\n", entry.path().string().c_str());
+            continue;
+        }
+
+        if (image.width + PADDING * 2 > page_size || image.height + PADDING * 2 > page_size) {
+            printf("skip %s: larger than page\n", image.name.c_str());
+            SOIL_free_image_data(image.data);
+            continue;
+        }
+
+        images.push_back(image);
+    }
+
+    int pages = pack(images, page_size);
+    std::filesystem::create_directories(root / ATLAS_DIRECTORY);
+
+    rapidjson::Document doc;
+    doc.SetObject();
+    auto& allocator = doc.GetAllocator();
+    rapidjson::Value page_list{rapidjson::kArrayType}, image_list{rapidjson::kObjectType};
+
+    for (int i = 0; i < pages; i++) {
+        std::vector<unsigned char> page(page_size * page_size * 4, 0);
+        for (const auto& image : images) {
+            if (image.page == i) {
+                blit(page, page_size, image);
+            }
+        }
+
+        std::string name = ATLAS_DIRECTORY + "/atlas_" + std::to_string(i) + ".png";
+        if (!SOIL_save_image((root / name).string().c_str(), SOIL_SAVE_TYPE_PNG,
+                             page_size, page_size, 4, page.data())) {
+            printf("can't save %s\n", name.c_str());
+        }
+
+        page_list.PushBack(rapidjson::Value{name.c_str(), allocator}, allocator);
+    }
+
+    for (auto& image : images) {
+        rapidjson::Value region{rapidjson::kObjectType};
+        region.AddMember("page", image.page, allocator);
+        region.AddMember("x", image.x, allocator);
+        region.AddMember("y", image.y, allocator);
+        region.AddMember("width", image.width, allocator);
+        region.AddMember("height", image.height, allocator);
+        image_list.AddMember(rapidjson::Value{image.name.c_str(), allocator}, region, allocator);
+
+        SOIL_free_image_data(image.data);
+        image.data = nullptr;
+    }
+
+    doc.AddMember("pages", page_list, allocator);
+    doc.AddMember("images", image_list, allocator);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer{buffer};
+    doc.Accept(writer);
+
+    FILE* fp = fopen(index.c_str(), "wb");
+    if (fp == nullptr) {
+        printf("can't write %s\n", index.c_str());
+        return -1;
+    }
+    fputs(buffer.GetString(), fp);
+    fclose(fp);
+
+    printf("%zu images packed into %d pages\n", images.size(), pages);
+    return 0;
+}
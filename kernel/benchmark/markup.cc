@@ -0,0 +1,90 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file markup.cc
+
+#include <chrono>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "utils/color_markup.h"
+
+/**
+ * Parse color markup in the way label used to, by std::regex.
+ * @param text: text with color markup
+ * @param colors: segments found
+ * @return std::string, text without color markup
+ */
+std::string parseByRegex(const std::string& text, std::vector<ngind::utils::ColorMarkup::Segment>& colors) {
+    std::string plain_text = text;
+    colors.clear();
+
+    std::smatch res;
+    std::regex reg{R"((\\)*\<color=(#[0123456789ABCDEF]{8})\>(.*)(\\)*\</color\>)"};
+    while (std::regex_search(plain_text, res, reg)) {
+        auto content = res.str(3);
+        auto color = static_cast<unsigned int>(std::stoul(res.str(2).substr(1), nullptr, 16));
+        auto begin = static_cast<unsigned int>(res.position());
+        colors.push_back({color, begin, begin + static_cast<unsigned int>(content.length())});
+        plain_text = res.prefix().str() + content + res.suffix().str();
+    }
+
+    return plain_text;
+}
+
+/**
+ * Compare parsing color markup of a 10KB dialogue by the single pass parser and by std::regex.
+ * Usage: markup_benchmark [iterations]
+ */
+int main(int argc, char* argv[]) {
+    size_t iterations = (argc > 1) ? std::stoul(argv[1]) : 100;
+
+    const std::string line = "Elder: The <color=#FF8000FF>dice</color> rolled <color=#00FF00FF>six</color> again.\n";
+    std::string dialogue;
+    while (dialogue.length() < 10 * 1024) {
+        dialogue += line;
+    }
+
+    using clock_type = std::chrono::steady_clock;
+    ngind::utils::ColorMarkup markup;
+    auto start = clock_type::now();
+    for (size_t i = 0; i < iterations; i++) {
+        markup.parse(dialogue);
+    }
+    std::chrono::duration<double, std::milli> single_pass = clock_type::now() - start;
+
+    std::vector<ngind::utils::ColorMarkup::Segment> colors;
+    std::string plain_text;
+    start = clock_type::now();
+    for (size_t i = 0; i < iterations; i++) {
+        plain_text = parseByRegex(dialogue, colors);
+    }
+    std::chrono::duration<double, std::milli> regex = clock_type::now() - start;
+
+    printf("dialogue: %zu bytes, %zu iterations\n", dialogue.length(), iterations);
+    printf("single pass: %.4f ms/parse, %zu segments\n", single_pass.count() / iterations, markup.getSegments().size());
+    printf("regex: %.4f ms/parse, %zu segments\n", regex.count() / iterations, colors.size());
+    return 0;
+}
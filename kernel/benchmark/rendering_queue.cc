@@ -0,0 +1,117 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file rendering_queue.cc
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "rendering/sort_key.h"
+
+/**
+ * Command sorted through a virtual call, like rendering commands used to be.
+ */
+class Command {
+public:
+    Command(const int& z, const unsigned int& program, const unsigned int& texture)
+        : _z(z), _program(program), _texture(texture) {}
+
+    virtual ~Command() = default;
+
+    virtual int getZ() const {
+        return _z;
+    }
+
+    inline unsigned int getProgram() const {
+        return _program;
+    }
+
+    inline unsigned int getTexture() const {
+        return _texture;
+    }
+
+private:
+    int _z;
+    unsigned int _program, _texture;
+};
+
+/**
+ * Compare sorting commands by std::sort on z and by packed keys with radix sort.
+ * Usage: rendering_queue_benchmark [iterations]
+ */
+int main(int argc, char* argv[]) {
+    size_t iterations = (argc > 1) ? std::stoul(argv[1]) : 20;
+    using clock_type = std::chrono::steady_clock;
+    using ngind::rendering::SortKey;
+
+    std::mt19937 random{20201017};
+    for (size_t size : {1000, 10000, 100000}) {
+        std::vector<Command> commands;
+        commands.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            commands.emplace_back(static_cast<int>(random() % 16) - 4, random() % 4 + 1, random() % 64 + 1);
+        }
+
+        std::vector<Command*> queue, sorted;
+        std::vector<uint64_t> keys, buffer;
+        double std_sort = 0.0, radix_sort = 0.0;
+        for (size_t it = 0; it < iterations; it++) {
+            queue.clear();
+            for (auto& command : commands) {
+                queue.push_back(&command);
+            }
+
+            auto start = clock_type::now();
+            std::sort(queue.begin(), queue.end(), [](Command* c1, Command* c2) -> bool {
+                return c1->getZ() < c2->getZ();
+            });
+            std::chrono::duration<double, std::milli> used = clock_type::now() - start;
+            std_sort += used.count();
+
+            queue.clear();
+            start = clock_type::now();
+            keys.clear();
+            for (auto& command : commands) {
+                keys.push_back(SortKey::pack(command.getZ(), command.getProgram(), command.getTexture(), queue.size()));
+                queue.push_back(&command);
+            }
+
+            SortKey::sort(keys, buffer);
+            sorted.resize(queue.size());
+            for (size_t i = 0; i < keys.size(); i++) {
+                sorted[i] = queue[SortKey::getSequence(keys[i])];
+            }
+            used = clock_type::now() - start;
+            radix_sort += used.count();
+        }
+
+        printf("%zu commands: std::sort %.4f ms, packed keys %.4f ms\n", size,
+               std_sort / iterations, radix_sort / iterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,265 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file slab_allocator.cc
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "memory/memory_pool.h"
+
+/**
+ * Memory pool as it was before slab allocator and pending list: objects are kept in a
+ * list and every clear scans the whole list once anything is released.
+ */
+class LegacyMemoryPool {
+public:
+    /**
+     * Object recycled by legacy memory pool, laid out like auto collection object was.
+     */
+    class Object {
+    public:
+        Object() : _sustain(0) {}
+
+        virtual ~Object() {
+            _sustain = 0;
+        }
+
+        inline void addReference() {
+            _sustain++;
+        }
+
+        inline void removeReference() {
+            if (_sustain == 0) {
+                return;
+            }
+
+            _sustain--;
+            if (_sustain == 0) {
+                getInstance()->_dirty = true;
+            }
+        }
+
+        inline int getSustain() const {
+            return _sustain;
+        }
+
+    private:
+        int _sustain;
+    };
+
+    static LegacyMemoryPool* getInstance() {
+        static LegacyMemoryPool instance;
+        return &instance;
+    }
+
+    template<typename T>
+    T* create() {
+        auto p = ::operator new(sizeof(T));
+        std::memset(p, 0, sizeof(T));
+        auto object = new(p) T();
+        _pool.push_back(object);
+        return object;
+    }
+
+    void clear() {
+        if (!_dirty) {
+            return;
+        }
+
+        auto tbm = _pool.end();
+        for (auto it = _pool.begin(); it != _pool.end(); ++it) {
+            if (tbm != _pool.end()) {
+                _pool.erase(tbm);
+                tbm = _pool.end();
+            }
+
+            auto temp = *it;
+            if (temp->getSustain() == 0) {
+                temp->~Object();
+                ::operator delete(temp);
+                *it = nullptr;
+                tbm = it;
+            }
+        }
+
+        if (tbm != _pool.end()) {
+            _pool.erase(tbm);
+        }
+
+        _dirty = false;
+    }
+
+private:
+    LegacyMemoryPool() : _dirty(false) {}
+
+    ~LegacyMemoryPool() {
+        for (auto* item : _pool) {
+            item->~Object();
+            ::operator delete(item);
+        }
+    }
+
+    bool _dirty;
+    std::list<Object*> _pool;
+};
+
+/**
+ * Object with some payload, so that sizes are about the sizes of quads, commands and components.
+ * @tparam Base: base class recycled by memory pool
+ * @tparam N: size of payload
+ */
+template<typename Base, size_t N>
+class Payload : public Base {
+private:
+    char _data[N];
+};
+
+/**
+ * Create an object of one of the payload sizes.
+ * @tparam Base: base class recycled by memory pool
+ * @tparam Pool: type of memory pool
+ * @param pool: the memory pool
+ * @param kind: index of payload size
+ * @return Base*, the object referred once
+ */
+template<typename Base, typename Pool>
+Base* create(Pool* pool, const size_t& kind) {
+    Base* object = nullptr;
+    switch (kind) {
+        case 0:
+            object = pool->template create<Payload<Base, 16>>();
+            break;
+        case 1:
+            object = pool->template create<Payload<Base, 64>>();
+            break;
+        case 2:
+            object = pool->template create<Payload<Base, 144>>();
+            break;
+        default:
+            object = pool->template create<Payload<Base, 224>>();
+            break;
+    }
+
+    object->addReference();
+    return object;
+}
+
+/**
+ * Churn objects through a memory pool: each frame some live objects are not referred any more,
+ * new ones are created and the pool is cleared at the end of frame.
+ * @tparam Base: base class recycled by memory pool
+ * @tparam Pool: type of memory pool
+ * @param pool: the memory pool
+ * @param live: number of live objects
+ * @param kinds: payload size of each created object
+ * @param victims: objects released in each frame
+ * @param frames: number of frames
+ * @param objects: live objects when churn ends
+ * @return double, milliseconds used
+ */
+template<typename Base, typename Pool>
+double churn(Pool* pool, const size_t& live, const std::vector<size_t>& kinds, const std::vector<size_t>& victims,
+             const size_t& frames, std::vector<Base*>& objects) {
+    using clock_type = std::chrono::steady_clock;
+    size_t next = 0;
+
+    auto start = clock_type::now();
+    for (; next < live; next++) {
+        objects.push_back(create<Base>(pool, kinds[next]));
+    }
+    pool->clear();
+
+    auto churn_number = victims.size() / frames;
+    for (size_t f = 0; f < frames; f++) {
+        for (size_t i = 0; i < churn_number; i++, next++) {
+            auto& object = objects[victims[f * churn_number + i] % live];
+            object->removeReference();
+            object = create<Base>(pool, kinds[next]);
+        }
+
+        pool->clear();
+    }
+
+    std::chrono::duration<double, std::milli> used = clock_type::now() - start;
+    return used.count();
+}
+
+/**
+ * Release all live objects.
+ * @tparam Base: base class recycled by memory pool
+ * @tparam Pool: type of memory pool
+ * @param pool: the memory pool
+ * @param objects: live objects
+ */
+template<typename Base, typename Pool>
+void release(Pool* pool, std::vector<Base*>& objects) {
+    for (auto object : objects) {
+        object->removeReference();
+    }
+
+    objects.clear();
+    pool->clear();
+}
+
+/**
+ * Compare create/removeReference churn with clear at the end of each frame on memory pool
+ * and on memory pool used before.
+ * Usage: slab_allocator_benchmark [frames]
+ */
+int main(int argc, char* argv[]) {
+    size_t frames = (argc > 1) ? std::stoul(argv[1]) : 200;
+    constexpr size_t LIVE_NUMBER = 10000, CHURN_NUMBER = LIVE_NUMBER / 4;
+
+    std::mt19937 random{20201017};
+    std::vector<size_t> victims(frames * CHURN_NUMBER), kinds(LIVE_NUMBER + frames * CHURN_NUMBER);
+    for (auto& victim : victims) {
+        victim = random();
+    }
+    for (auto& kind : kinds) {
+        kind = random() % 4;
+    }
+
+    auto legacy = LegacyMemoryPool::getInstance();
+    std::vector<LegacyMemoryPool::Object*> legacy_objects;
+    auto used = churn(legacy, LIVE_NUMBER, kinds, victims, frames, legacy_objects);
+    printf("list memory pool: %.4f ms\n", used);
+    release(legacy, legacy_objects);
+
+    auto pool = ngind::memory::MemoryPool::getInstance();
+    std::vector<ngind::memory::AutoCollectionObject*> objects;
+    used = churn(pool, LIVE_NUMBER, kinds, victims, frames, objects);
+    auto statistics = pool->getStatistics();
+    printf("slab memory pool: %.4f ms, %zu/%zu bytes used, %zu bytes fragmented\n", used,
+           statistics.used, statistics.reserved, statistics.fragmented);
+    release(pool, objects);
+
+    ngind::memory::MemoryPool::destroyInstance();
+    return 0;
+}
@@ -60,6 +60,11 @@ public:
      */
     virtual void update(const float&) {}
 
+    /**
+     * Send rendering commands of this component. It's called once per frame after all updates.
+     */
+    virtual void render() {}
+
     /**
      * Initialization function of this class used by configuration creating method.
      * @param object: the configuration data
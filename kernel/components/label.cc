@@ -23,7 +23,7 @@
 
 #include "label.h"
 
-#include <regex>
+#include <locale>
 #include <codecvt>
 
 #include "resources/resources_manager.h"
@@ -35,7 +35,8 @@
 namespace ngind::components {
 
 Label::Label() : RendererComponent(),
-_font(nullptr), _size(12), _line_space{3}, _alignment{ALIGNMENT_LEFT} {
+_font(nullptr), _size(12), _sdf(false), _max_width(0), _layout_dirty(true),
+_line_space{3}, _alignment{ALIGNMENT_LEFT} {
 }
 
 Label::~Label() {
@@ -44,23 +45,34 @@ Label::~Label() {
         _font = nullptr;
     }
 
-    for (auto& cmd : _commands) {
-        cmd->removeReference();
+    // commands destroyed with the same arena may be gone already.
+    if (!memory::MemoryPool::getInstance()->isTearingDown(this)) {
+        for (auto& run : _runs) {
+            run.command->getQuad()->removeReference();
+            run.command->removeReference();
+        }
     }
 
-    _commands.clear();
+    _runs.clear();
 }
 
 void Label::update(const float& delta) {
     RendererComponent::update(delta);
-    this->draw();
+}
+
+void Label::promote() {
+    RendererComponent::promote();
+    for (auto& run : _runs) {
+        run.command->promote();
+    }
 }
 
 void Label::init(const typename resources::ConfigResource::JsonObject& data) {
     try {
         _component_name = data["type"].GetString();
         _font = resources::ResourcesManager::getInstance()->load<resources::FontResource>(data["font"].GetString());
-        _program = resources::ResourcesManager::getInstance()->load<resources::ProgramResource>("text");
+        _sdf = data.HasMember("sdf") && data["sdf"].GetBool();
+        _program = resources::ResourcesManager::getInstance()->load<resources::ProgramResource>(_sdf ? "text_sdf" : "text");
         _size = data["size"].GetInt();
         _color = rendering::Color{data["color"].GetString()};
         _text = data["text"].GetString();
@@ -85,147 +97,181 @@ void Label::draw() {
         logger->log("Parent object of label component should not be null.");
         logger->flush();
     }
-    if (_commands.empty() || _dirty) {
+
+    if (_layout_dirty) {
         parseText();
+        _layout_dirty = false;
+        _dirty = true;
+    }
+
+    if (_dirty) {
+        updateTransform();
         _dirty = false;
     }
 
-    for (auto & cmd : _commands) {
-        rendering::Renderer::getInstance()->addRendererCommand(cmd);
+    for (auto& run : _runs) {
+        rendering::Renderer::getInstance()->addRendererCommand(run.command);
     }
 }
 
 void Label::parseText() {
-    if (_text.empty()) {
-        return;
+    for (auto& run : _runs) {
+        run.command->getQuad()->removeReference();
+        run.command->removeReference();
     }
+    _runs.clear();
+    _widths.clear();
+    _max_width = 0;
 
-    if (!_commands.empty()) {
-        for (auto& c : _commands) {
-            c->removeReference();
-        }
-        _commands.clear();
+    if (_text.empty()) {
+        return;
     }
 
-    this->replaceEscape();
-
-    std::wstring w_text = L"";
-    bool utf8 = false;
-    for (const auto& c : _text) {
+    _markup.parse(_text);
+    const auto& plain_text = _markup.getPlainText();
+    for (const auto& c : plain_text) {
         if ((c & 0x80) != 0) {
-            utf8 = true;
             std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-            w_text = conv.from_bytes(_text);
-            break;
+            this->layoutText(conv.from_bytes(plain_text));
+            return;
         }
     }
 
-    if (utf8) {
-        this->parseUTF8Text(w_text);
-        return;
-    }
-
-    auto temp = dynamic_cast<objects::EntityObject*>(_parent);
-    auto pos = temp->getGlobalPosition();
-
-    float scale = static_cast<float>(_size) / rendering::TrueTypeFont::DEFAULT_FONT_SIZE;
-    auto cl_it = _colors.begin();
-    auto color = (cl_it == _colors.end()) ? _color : std::get<0>(*cl_it);
-    auto left = (cl_it == _colors.end()) ? 0 : std::get<1>(*cl_it),
-            right = (cl_it == _colors.end()) ? 0 : std::get<2>(*cl_it);
+    this->layoutText(plain_text);
+}
 
-    float max_width = 0, max_height = 0, current_width = 0;
-    std::vector<float> widths;
+template<typename T>
+void Label::layoutText(const std::basic_string<T>& text) {
+    float scale = rendering::TrueTypeFont::getScale(_size, _sdf);
+    const auto& segments = _markup.getSegments();
+    auto cl_it = segments.begin();
 
-    for (int i = 0; i < _text.length(); i++) {
-        auto c = _text[i];
+    float current_width = 0;
+    for (const auto& c : text) {
         if (c == '\n') {
-            max_width = std::max(max_width, current_width);
-            widths.push_back(current_width);
+            _max_width = std::max(_max_width, current_width);
+            _widths.push_back(current_width);
             current_width = 0;
             continue;
         }
 
-        auto ch = (*_font)->generateCharacterData(c);
+        auto ch = (*_font)->generateCharacterData(c, _size, _sdf);
         current_width += (ch.advance.x >> 6) * scale;
     }
 
-    max_width = std::max(max_width, current_width);
-    widths.push_back(current_width);
+    _max_width = std::max(_max_width, current_width);
+    _widths.push_back(current_width);
+
+    std::vector<GLfloat> vertices;
+    GLuint texture = 0;
+    rendering::Color color = _color;
+    bool default_color = true;
 
-    current_width = 0; max_height = 0;
-    glm::mat4 model = getModelMatrix(max_width, widths[0], max_height);
-    for (int i = 0, j = 0; i < _text.length(); i++) {
-        if (_text[i] == '\n') {
+    float max_height = 0;
+    current_width = 0;
+    int j = 0;
+    for (size_t i = 0; i < text.length(); i++) {
+        if (text[i] == '\n') {
+            createCommand(vertices, texture, color, j, default_color);
             j++;
             current_width = 0;
-            max_height += static_cast<float>((*_font)->getMaxHeight()) * scale * 2 + _line_space;
-            model = getModelMatrix(max_width, widths[j], max_height);
+            max_height += getLineHeight();
             continue;
         }
 
-        rendering::Character ch = (*_font)->generateCharacterData(_text[i]);
-        auto x = current_width + ch.bearing.x * scale;
+        rendering::Character ch = (*_font)->generateCharacterData(text[i], _size, _sdf);
+        current_width += (ch.advance.x >> 6) * scale;
+        if (ch.texture == 0) {
+            continue;
+        }
+
+        while (cl_it != segments.end() && i >= cl_it->end) {
+            cl_it++;
+        }
+
+        bool ch_default_color = (cl_it == segments.end() || i < cl_it->begin);
+        rendering::Color ch_color = _color;
+        if (!ch_default_color) {
+            ch_color.r = (cl_it->color & 0xFF000000) >> 24;
+            ch_color.g = (cl_it->color & 0x00FF0000) >> 16;
+            ch_color.b = (cl_it->color & 0x0000FF00) >> 8;
+            ch_color.a = cl_it->color & 0x000000FF;
+        }
+        if (ch.texture != texture || ch_default_color != default_color || ch_color != color) {
+            createCommand(vertices, texture, color, j, default_color);
+            texture = ch.texture;
+            color = ch_color;
+            default_color = ch_default_color;
+        }
+
+        auto x = current_width - (ch.advance.x >> 6) * scale + ch.bearing.x * scale;
         auto y = -max_height - (ch.size.y - ch.bearing.y) * scale;
         auto width = ch.size.x * scale;
         auto height = ch.size.y * scale;
 
-        auto quad = memory::MemoryPool::getInstance()
-                        ->create<rendering::Quad, std::initializer_list<GLfloat>>({
-                            x + width, y + height, 1.0f, 0.0f,
-                            x + width, y, 1.0f, 1.0f,
-                            x, y, 0.0f, 1.0f,
-                            x, y + height, 0.0f, 0.0f,});
-        quad->addReference();
-
+        vertices.insert(vertices.end(), {
+            x + width, y + height, ch.uv.z, ch.uv.y,
+            x + width, y, ch.uv.z, ch.uv.w,
+            x, y, ch.uv.x, ch.uv.w,
+            x, y + height, ch.uv.x, ch.uv.y});
+    }
 
-        auto command = memory::MemoryPool::getInstance()
-                           ->create<rendering::QuadRenderingCommand>(quad, ch.texture);
+    createCommand(vertices, texture, color, _widths.size() - 1, default_color);
+}
 
-        command->addReference();
-        _commands.push_back(command);
-        _commands.back()->setProgram(_program->get());
-        _commands.back()->setZ(temp->getZOrder());
-        _commands.back()->setModel(model);
+void Label::createCommand(std::vector<GLfloat>& vertices, const GLuint& texture, const rendering::Color& color,
+                          const size_t& line, const bool& default_color) {
+    if (vertices.empty()) {
+        return;
+    }
 
-        if (!_colors.empty() && i >= left && i < right) {
-          if (i == right && cl_it + 1 != _colors.end()) {
-            cl_it++;
-            color = std::get<0>(*cl_it);
-            left = std::get<1>(*cl_it), right = std::get<2>(*cl_it);
-          }
+    auto quad = memory::MemoryPool::getInstance()->createNear<rendering::Quad, std::vector<GLfloat>>(this, std::move(vertices));
+    if (quad == nullptr) {
+        return;
+    }
 
-          _commands.back()->setColor(color);
-        }
-        else {
-          _commands.back()->setColor(_color);
-        }
+    quad->addReference();
+    vertices.clear();
 
-        current_width += (ch.advance.x >> 6) * scale;
-    }
+    auto command = memory::MemoryPool::getInstance()->createNear<rendering::QuadRenderingCommand>(this, quad, texture);
+    command->addReference();
+    command->setProgram(_program->get());
+    command->setColor(color);
+    _runs.push_back(GlyphRun{command, line, default_color});
 }
 
-void Label::replaceEscape() {
-    _colors.clear();
+void Label::updateTransform() {
+    auto temp = dynamic_cast<objects::EntityObject*>(_parent);
+    auto line_height = getLineHeight();
+
+    std::vector<glm::mat4> models;
+    models.reserve(_widths.size());
+    for (size_t i = 0; i < _widths.size(); i++) {
+        models.push_back(getModelMatrix(_max_width, _widths[i], line_height * i));
+    }
 
-    std::smatch res;
-    std::regex reg{R"((\\)*\<color=(#[0123456789ABCDEF]{8})\>(.*)(\\)*\</color\>)"};
-    while (std::regex_search(_text, res, reg)) {
-        auto text = res.str(3);
-        _colors.emplace_back(rendering::Color{res.str(2)}, res.position(), res.position() + text.length());
-        _text = res.prefix().str() + text + res.suffix().str();
+    for (auto& run : _runs) {
+        run.command->setModel(models[run.line]);
+        run.command->setZ(temp->getZOrder());
+        if (run.default_color) {
+            run.command->setColor(_color);
+        }
     }
 }
 
+float Label::getLineHeight() const {
+    auto scale = rendering::TrueTypeFont::getScale(_size, _sdf);
+    return static_cast<float>((*_font)->getMaxHeight(_size, _sdf)) * scale * 2 + _line_space;
+}
 glm::mat4 Label::getModelMatrix(const float& max_width, const float& width, const float& max_height) {
     auto temp = dynamic_cast<objects::EntityObject*>(_parent);
-    auto pos = temp->getGlobalPosition();
-    auto global_scale = temp->getGlobalScale();
-    auto rotate = temp->getGlobalRotation();
+    auto pos = temp->getRenderPosition();
+    auto global_scale = temp->getRenderScale();
+    auto rotate = temp->getRenderRotation();
     auto anchor = temp->getAnchor();
 
-    float scale = static_cast<float>(_size) / rendering::TrueTypeFont::DEFAULT_FONT_SIZE;
-    pos.y -= static_cast<float>((*_font)->getMaxHeight()) * scale;
+    float scale = rendering::TrueTypeFont::getScale(_size, _sdf);
+    pos.y -= static_cast<float>((*_font)->getMaxHeight(_size, _sdf)) * scale;
 
     glm::mat4 model{1.0f};
     if (_alignment == ALIGNMENT_LEFT) {
@@ -254,85 +300,4 @@ Label* Label::getComponent(Object* parent) {
     return parent->getComponent<Label>("Label");
 }
 
-void Label::parseUTF8Text(const std::wstring& text) {
-    auto temp = dynamic_cast<objects::EntityObject*>(_parent);
-    auto pos = temp->getGlobalPosition();
-
-    float scale = static_cast<float>(_size) / rendering::TrueTypeFont::DEFAULT_FONT_SIZE;
-    auto cl_it = _colors.begin();
-    auto color = (cl_it == _colors.end()) ? _color : std::get<0>(*cl_it);
-    auto left = (cl_it == _colors.end()) ? 0 : std::get<1>(*cl_it),
-            right = (cl_it == _colors.end()) ? 0 : std::get<2>(*cl_it);
-
-    float max_width = 0, max_height = 0, current_width = 0;
-    std::vector<float> widths;
-
-    for (int i = 0; i < text.length(); i++) {
-        auto c = text[i];
-        if (c == '\n') {
-            max_width = std::max(max_width, current_width);
-            widths.push_back(current_width);
-            current_width = 0;
-            continue;
-        }
-
-        auto ch = (*_font)->generateCharacterData(c);
-        current_width += (ch.advance.x >> 6) * scale;
-    }
-
-    max_width = std::max(max_width, current_width);
-    widths.push_back(current_width);
-
-    current_width = 0; max_height = 0;
-    glm::mat4 model = getModelMatrix(max_width, widths[0], max_height);
-    for (int i = 0, j = 0; i < text.length(); i++) {
-        if (text[i] == L'\n') {
-            j++;
-            current_width = 0;
-            max_height += static_cast<float>((*_font)->getMaxHeight()) * scale * 2 + _line_space;
-            model = getModelMatrix(max_width, widths[j], max_height);
-            continue;
-        }
-
-        rendering::Character ch = (*_font)->generateCharacterData(text[i]);
-
-        auto x = current_width + ch.bearing.x * scale;
-        auto y = -max_height - (ch.size.y - ch.bearing.y) * scale;
-        auto width = ch.size.x * scale;
-        auto height = ch.size.y * scale;
-
-        auto quad = memory::MemoryPool::getInstance()
-                        ->create<rendering::Quad, std::initializer_list<GLfloat>>({
-                            x + width, y + height, 1.0f, 0.0f,
-                            x + width, y, 1.0f, 1.0f,
-                            x, y, 0.0f, 1.0f,
-                            x, y + height, 0.0f, 0.0f,});
-        quad->addReference();
-
-
-        auto command = memory::MemoryPool::getInstance()
-                           ->create<rendering::QuadRenderingCommand>(quad, ch.texture);
-        command->addReference();
-        _commands.push_back(command);
-        _commands.back()->setProgram(_program->get());
-        _commands.back()->setZ(temp->getZOrder());
-        _commands.back()->setModel(model);
-
-        if (!_colors.empty() && i >= left && i < right) {
-          if (i == right && cl_it + 1 != _colors.end()) {
-            cl_it++;
-            color = std::get<0>(*cl_it);
-            left = std::get<1>(*cl_it), right = std::get<2>(*cl_it);
-          }
-
-          _commands.back()->setColor(color);
-        }
-        else {
-          _commands.back()->setColor(_color);
-        }
-
-        current_width += (ch.advance.x >> 6) * scale;
-    }
-}
-
 } // namespace ngind::components
@@ -26,7 +26,6 @@
 
 #include <string>
 #include <vector>
-#include <tuple>
 
 #include "renderer_component.h"
 #include "rendering/color.h"
@@ -35,6 +34,7 @@
 #include "rendering/quad_rendering_command.h"
 
 #include "component_factory.h"
+#include "utils/color_markup.h"
 #include "script/lua_registration.h"
 
 namespace ngind::log {
@@ -69,6 +69,11 @@ public:
      */
     void update(const float& delta) override;
 
+    /**
+     * @see kernel/memory/auto_collection_object.h
+     */
+    void promote() override;
+
     /**
      * @see kernel/components/component.h
      */
@@ -93,8 +98,10 @@ public:
      * @param text: new text
      */
     inline void setText(const std::string& text) {
-        _text = text;
-        parseText();
+        if (_text != text) {
+            _text = text;
+            _layout_dirty = true;
+        }
     }
 
     /**
@@ -120,7 +127,7 @@ public:
      */
     inline void setLineSpace(size_t line_space) {
         _line_space = line_space;
-        _dirty = true;
+        _layout_dirty = true;
     }
 
     /**
@@ -129,7 +136,7 @@ public:
      */
     inline void setTextSize(size_t size) {
         _size = size;
-        _dirty = true;
+        _layout_dirty = true;
     }
 
     /**
@@ -156,6 +163,14 @@ public:
         return _size;
     }
 
+    /**
+     * Check if glyphs are drawn from signed distance fields.
+     * @return bool, true if signed distance fields are used
+     */
+    inline bool isSDF() const {
+        return _sdf;
+    }
+
     friend class ngind::log::VisualLogger;
 private:
     /**
@@ -174,14 +189,54 @@ private:
     size_t _size;
 
     /**
-     * Rendering commands of label
+     * True if glyphs are drawn from signed distance fields
+     */
+    bool _sdf;
+
+    /**
+     * Glyphs in the same line sharing color and atlas page.
+     */
+    struct GlyphRun {
+        /**
+         * Rendering command drawing the glyphs
+         */
+        rendering::QuadRenderingCommand* command;
+
+        /**
+         * Index of line
+         */
+        size_t line;
+
+        /**
+         * True if glyphs use the color of label instead of color markup
+         */
+        bool default_color;
+    };
+
+    /**
+     * Parser of color markup in text
      */
-    std::vector<rendering::QuadRenderingCommand*> _commands;
+    utils::ColorMarkup _markup;
 
     /**
-     * Colors each segment uses
+     * Glyph runs of label
      */
-    std::vector<std::tuple<rendering::Color, unsigned int, unsigned int>> _colors;
+    std::vector<GlyphRun> _runs;
+
+    /**
+     * Width of each line
+     */
+    std::vector<float> _widths;
+
+    /**
+     * Width of the widest line
+     */
+    float _max_width;
+
+    /**
+     * True if glyphs should be laid out again. Transform changes only need to update model matrices.
+     */
+    bool _layout_dirty;
 
     /**
      * Additional space between two lines
@@ -199,14 +254,36 @@ private:
     void parseText();
 
     /**
-     * Parse the UTF8 text to determine rendering commands
+     * Lay out glyphs of the text. Glyphs in the same line sharing color and atlas page
+     * are merged into one rendering command.
+     * @tparam T: type of characters
+     * @param text: the text without color markup
+     */
+    template<typename T>
+    void layoutText(const std::basic_string<T>& text);
+
+    /**
+     * Create a glyph run for glyphs in the vertices buffer and clear the buffer.
+     * Nothing happens if the buffer is empty.
+     * @param vertices: the vertices buffer
+     * @param texture: the atlas page texture
+     * @param color: color of glyphs
+     * @param line: index of line
+     * @param default_color: true if glyphs use the color of label
+     */
+    void createCommand(std::vector<GLfloat>& vertices, const GLuint& texture, const rendering::Color& color,
+                       const size_t& line, const bool& default_color);
+
+    /**
+     * Update model matrices, z order and color of glyph runs without laying out glyphs again.
      */
-    void parseUTF8Text(const std::wstring& text);
+    void updateTransform();
 
     /**
-     * Replace all <color></color>
+     * Get the distance between tops of two lines.
+     * @return float, the distance
      */
-    void replaceEscape();
+    float getLineHeight() const;
 
     /**
      * Calculate the model matrix
@@ -236,6 +313,7 @@ NGIND_LUA_BRIDGE_REGISTRATION(Label) {
             .addFunction("getLineSpace", &Label::getLineSpace)
             .addFunction("setTextSize", &Label::setTextSize)
             .addFunction("getTextSize", &Label::getTextSize)
+            .addFunction("isSDF", &Label::isSDF)
         .endClass()
     .endNamespace();
 
@@ -57,6 +57,13 @@ public:
      */
     void update(const float&) override {};
 
+    /**
+     * @see kernel/components/component.h
+     */
+    void render() override {
+        this->draw();
+    }
+
     /**
      * Initialization function of this class used by configuration creating method.
      * @param data: the configuration data this component initialization process requires.
@@ -91,7 +98,7 @@ public:
 protected:
     /**
      * Create some rendering command and send them to the rendering queue in order to show
-     * something on the screen. This method should be called in update.
+     * something on the screen. This method is called by render.
      */
     virtual void draw() = 0;
 
@@ -35,19 +35,18 @@ namespace ngind::components {
 
 Sprite::Sprite()
         : RendererComponent(),
-        _command(nullptr), _quad(nullptr),
+        _command(nullptr),
         _texture(nullptr), _lb(), _rt() {
 }
 
 Sprite::~Sprite() {
-    if (_command != nullptr) {
-        _quad->removeReference();
-        _quad = nullptr;
-
+    // the command destroyed with the same arena may be gone already.
+    if (_command != nullptr && !memory::MemoryPool::getInstance()->isTearingDown(this)) {
         _command->removeReference();
-        _command = nullptr;
     }
 
+    _command = nullptr;
+
     if (_texture != nullptr) {
         resources::ResourcesManager::getInstance()->release(_texture);
         _texture = nullptr;
@@ -56,7 +55,13 @@ Sprite::~Sprite() {
 
 void Sprite::update(const float& delta) {
     RendererComponent::update(delta);
-    this->draw();
+}
+
+void Sprite::promote() {
+    RendererComponent::promote();
+    if (_command != nullptr) {
+        _command->promote();
+    }
 }
 
 void Sprite::setImage(const std::string& filename) {
@@ -83,35 +88,31 @@ void Sprite::draw() {
 
     auto temp = dynamic_cast<objects::EntityObject*>(_parent);
 
-    if (_command == nullptr || _dirty) {
-        if (_command != nullptr) {
-            _quad->removeReference();
-            _quad = nullptr;
-
-            _command->removeReference();
-            _command = nullptr;
+    if (_command == nullptr) {
+        _command = memory::MemoryPool::getInstance()
+                ->createNear<rendering::InstancedQuadRenderingCommand>(this, (*_texture)->getTextureID());
+        if (_command == nullptr) {
+            return;
         }
 
-        auto texture_size = (*_texture)->getSize();
-        _quad = memory::MemoryPool::getInstance()->create<rendering::Quad, std::initializer_list<GLfloat>>(
-                {
-                        _rt.x - _lb.x, _rt.y - _lb.y, static_cast<float>(_rt.x) / texture_size.x, static_cast<float>(_lb.y) / texture_size.y, // Top Right
-                        _rt.x - _lb.x, 0.0f, static_cast<float>(_rt.x) / texture_size.x, static_cast<float>(_rt.y) / texture_size.y, // Bottom Right
-                        0.0f, 0.0f, static_cast<float>(_lb.x) / texture_size.x, static_cast<float>(_rt.y) / texture_size.y, // Bottom Left
-                        0.0f, _rt.y - _lb.y, static_cast<float>(_lb.x) / texture_size.x, static_cast<float>(_lb.y) / texture_size.y  // Top Left
-                }
-                );
-        _quad->addReference();
-        _command = memory::MemoryPool::getInstance()
-                ->create<rendering::QuadRenderingCommand>(_quad, (*_texture)->getTextureID());
         _command->addReference();
+        _dirty = true;
+    }
+
+    if (_dirty) {
+        auto texture_size = (*_texture)->getSize();
+        auto lb = (*_texture)->mapCoordinate(_lb / texture_size);
+        auto rt = (*_texture)->mapCoordinate(_rt / texture_size);
+        _command->setTexture((*_texture)->getTextureID());
+        _command->setSize({_rt.x - _lb.x, _rt.y - _lb.y});
+        _command->setUV({lb.x, rt.y, rt.x, lb.y});
 
         _command->setModel(getModelMatrix());
         _command->setColor(_color);
         _command->setZ(temp->getZOrder());
         _command->setProgram(_program->get());
 
-        _dirty = false;
+        _dirty = !(*_texture)->isReady();
     }
 
     rendering::Renderer::getInstance()->addRendererCommand(_command);
@@ -122,7 +123,7 @@ void Sprite::init(const typename resources::ConfigResource::JsonObject& data) {
         _component_name = data["type"].GetString();
         std::string name = data["filename"].GetString();
         if (!name.empty()) {
-            this->setImage(name);
+            _texture = resources::ResourcesManager::getInstance()->load<resources::TextureResource>(name, true);
         }
         _program = resources::ResourcesManager::getInstance()->load<resources::ProgramResource>(data["shader"].GetString());
 
@@ -150,9 +151,9 @@ Sprite* Sprite::create(const typename resources::ConfigResource::JsonObject& dat
 
 glm::mat4 Sprite::getModelMatrix() {
     auto temp = dynamic_cast<objects::EntityObject*>(_parent);
-    auto pos = temp->getGlobalPosition();
-    auto rotate = temp->getGlobalRotation();
-    auto scale = temp->getGlobalScale();
+    auto pos = temp->getRenderPosition();
+    auto rotate = temp->getRenderRotation();
+    auto scale = temp->getRenderScale();
     auto anchor = temp->getAnchor();
     auto texture_size = glm::vec2 {std::abs(_rt.x - _lb.x), std::abs(_rt.y - _lb.y)};
 
@@ -26,7 +26,7 @@
 
 #include <string>
 
-#include "rendering/quad_rendering_command.h"
+#include "rendering/instanced_quad_rendering_command.h"
 #include "renderer_component.h"
 #include "resources/texture_resource.h"
 #include "rendering/color.h"
@@ -56,6 +56,11 @@ public:
      */
     void update(const float& delta) override;
 
+    /**
+     * @see kernel/memory/auto_collection_object.h
+     */
+    void promote() override;
+
     /**
      * Initialization function of this class used by configuration creating method. This function
      * is inherited from Component
@@ -155,14 +160,9 @@ private:
     glm::vec2 _lb, _rt;
 
     /**
-     * Render command this sprite used.
-     */
-    rendering::QuadRenderingCommand* _command;
-
-    /**
-     * Quad information.
+     * Render command this sprite used. It is updated in place when the sprite changes.
      */
-    rendering::Quad* _quad;
+    rendering::InstancedQuadRenderingCommand* _command;
 
     /**
     * Calculate the model matrix
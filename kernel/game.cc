@@ -24,6 +24,8 @@
 #include "game.h"
 
 #include <utility>
+#include <chrono>
+#include <cmath>
 
 #include "rendering/renderer.h"
 #include "resources/resources_manager.h"
@@ -34,11 +36,17 @@
 #include "rendering/adaptor.h"
 #include "script/observer.h"
 #include "input/input.h"
+#include "utils/thread_pool.h"
+#include "rendering/texture_loader.h"
+#include "rendering/screen_capture.h"
+#include "timer/frame_statistics.h"
+#include "timer/profiler.h"
 
 namespace ngind {
 Game* Game::_instance = nullptr;
 
-Game::Game() : _global_timer(), _loop_flag(true), _current_world(nullptr), _transition(), _trans_next(false), _global_settings{nullptr} {
+Game::Game() : _global_timer(), _loop_flag(true), _current_world(nullptr), _transition(), _trans_next(false), _global_settings{nullptr},
+    _fixed_step(0.0f), _max_steps(1), _accumulator(0.0f) {
 }
 
 Game::~Game() {
@@ -48,8 +56,19 @@ Game::~Game() {
         _stack.pop();
     }
 
+    // destroy worlds while scripts still work, so only objects really leaked are left in memory pool.
+    for (auto& [name, world] : _worlds) {
+        world->removeReference();
+    }
+
     _worlds.clear();
+    memory::MemoryPool::getInstance()->clear();
     script::LuaState::destroyInstance();
+    rendering::ScreenCapture::destroyInstance();
+    utils::ThreadPool::destroyInstance();
+    rendering::TextureLoader::destroyInstance();
+    timer::Profiler::destroyInstance();
+    memory::MemoryPool::destroyInstance();
 }
 
 Game* Game::getInstance() {
@@ -76,6 +95,7 @@ void Game::destroyInstance() {
 void Game::start() {
     this->_global_settings = resources::ResourcesManager::getInstance()->load<resources::ConfigResource>("global_settings.json");
     auto render = rendering::Renderer::getInstance();
+    bool headless = (*(*_global_settings)).HasMember("headless") && (*_global_settings)["headless"].GetBool();
 
     try {
         render->createWindow((*_global_settings)["window-width"].GetInt(),
@@ -84,7 +104,8 @@ void Game::start() {
                              (*_global_settings)["resolution-height"].GetInt(),
                              (*_global_settings)["window-title"].GetString(),
                              (*_global_settings)["window-icon"].GetString(),
-                             (*_global_settings)["window-full-screen"].GetBool());
+                             (*_global_settings)["window-full-screen"].GetBool(),
+                             headless);
 
         ui::EventSystem::getInstance()->init((*_global_settings)["resolution-height"].GetInt());
 
@@ -109,6 +130,21 @@ void Game::start() {
             rendering::Adaptor::getInstance()->
                     setResolutionAdaptionTactic(rendering::ResolutionAdaptionTactic::EXACT_FIT);
         }
+
+        if ((*(*_global_settings)).HasMember("post-process")) {
+            render->setPostProcess((*_global_settings)["post-process"].GetString());
+        }
+
+        if ((*(*_global_settings)).HasMember("update-mode") &&
+            std::string{(*_global_settings)["update-mode"].GetString()} == "FIXED") {
+            _fixed_step = 1.0f / (*_global_settings)["fixed-update-rate"].GetFloat();
+            _max_steps = (*_global_settings)["max-update-steps"].GetUint();
+        }
+
+        if ((*(*_global_settings)).HasMember("texture-upload-budget")) {
+            rendering::TextureLoader::getInstance()->
+                    setUploadBudget((*_global_settings)["texture-upload-budget"].GetUint());
+        }
     }
     catch (...) {
         auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
@@ -129,6 +165,26 @@ void Game::start() {
     const float MIN_DURATION = 1.0f / MAX_FRAME_RATE;
     float duration = 1.0f / 60.0f;
     logger->registerVariable("frame rate", "0");
+    logger->registerVariable("draw calls", "0");
+    logger->registerVariable("quads", "0");
+    logger->registerVariable("submitted", "0");
+    logger->registerVariable("culled", "0");
+    logger->registerVariable("upload backlog", "0");
+#if NGIND_PROFILER
+    logger->registerVariable("frame time", "");
+#endif
+    logger->registerVariable("object memory", "");
+
+    int census_key = GLFW_KEY_UNKNOWN;
+    if ((*(*_global_settings)).HasMember("census-key")) {
+        census_key = (*_global_settings)["census-key"].GetInt();
+    }
+
+    if (headless) {
+        runHeadless(MIN_DURATION);
+        return;
+    }
+
     _global_timer.start();
     while (_loop_flag) {
         if (_trans_next) {
@@ -139,30 +195,125 @@ void Game::start() {
 
         input::Input::getInstance()->update();
         glfwPollEvents();
+        if (census_key != GLFW_KEY_UNKNOWN && input::Input::getInstance()->getKeyPressed(census_key)) {
+            memory::MemoryPool::getInstance()->dumpCensus("memory.log");
+        }
         render->clearScene(_current_world->getBackgroundColor());
 
-        update(duration);
+        simulate(duration);
 
         logger->draw();
         _loop_flag &= render->startRenderingLoopOnce();
+        logger->updateVariable("draw calls", render->getDrawCallsNumber());
+        logger->updateVariable("quads", render->getQuadsNumber());
+        logger->updateVariable("submitted", render->getSubmittedNumber());
+        logger->updateVariable("culled", render->getCulledNumber());
+        logger->updateVariable("upload backlog", rendering::TextureLoader::getInstance()->getUploadBacklog());
+        for (const auto& [name, time] : render->getGpuTimes()) {
+            logger->registerVariable("gpu " + name);
+            logger->updateVariable("gpu " + name, time);
+        }
 
         memory::MemoryPool::getInstance()->clear();
+        auto memory_statistics = memory::MemoryPool::getInstance()->getStatistics();
+        logger->updateVariable("object memory", std::to_string(memory_statistics.used / 1024) + "/" +
+                                                std::to_string(memory_statistics.reserved / 1024) + "KB, " +
+                                                std::to_string(memory_statistics.fragmented / 1024) + "KB fragmented");
 
         duration = _global_timer.getTick();
         float rest = MIN_DURATION - duration;
-        if (rest >= 0.005) {
+        if (rest > 0.0f) {
             _global_timer.sleep(rest);
             logger->updateVariable("frame rate", MAX_FRAME_RATE);
             duration = MIN_DURATION;
         }
-        else if (std::abs(rest) <= 0.0075) {
-            logger->updateVariable("frame rate", MAX_FRAME_RATE);
-            duration = MIN_DURATION;
-        }
         else {
             logger->updateVariable("frame rate", 1.0f / duration);
         }
+
+#if NGIND_PROFILER
+        timer::Profiler::getInstance()->endFrame(duration);
+        logger->updateVariable("frame time", timer::Profiler::getInstance()->getFrameGraph());
+#endif
+    }
+
+    dumpProfile();
+}
+
+void Game::runHeadless(const float& delta) {
+    size_t frames = 600;
+    if ((*(*_global_settings)).HasMember("headless-frames")) {
+        frames = (*_global_settings)["headless-frames"].GetUint();
+    }
+
+    bool hash = (*(*_global_settings)).HasMember("headless-hash") && (*_global_settings)["headless-hash"].GetBool();
+
+    auto render = rendering::Renderer::getInstance();
+    timer::FrameStatistics statistics{frames};
+    while (_loop_flag && statistics.getFramesNumber() < frames) {
+        auto start = std::chrono::steady_clock::now();
+        if (_trans_next) {
+            _transition();
+            _trans_next = false;
+            script::Observer::getInstance()->reset();
+        }
+
+        glfwPollEvents();
+        render->clearScene(_current_world->getBackgroundColor());
+
+        simulate(delta);
+
+        _loop_flag &= render->startRenderingLoopOnce();
+        if (hash) {
+            statistics.addHash(render->hashFrame());
+        }
+
+        memory::MemoryPool::getInstance()->clear();
+
+        std::chrono::duration<double> used = std::chrono::steady_clock::now() - start;
+        statistics.record(used.count());
+#if NGIND_PROFILER
+        timer::Profiler::getInstance()->endFrame(static_cast<float>(used.count()));
+#endif
+    }
+
+    statistics.report("headless.log");
+    dumpProfile();
+}
+
+void Game::simulate(const float& duration) {
+    if (_fixed_step <= 0.0f) {
+        update(duration);
+        _current_world->render(1.0f);
+        return;
+    }
+
+    _accumulator += duration;
+    size_t steps = 0;
+    while (_accumulator >= _fixed_step && steps < _max_steps) {
+        _current_world->saveState();
+        update(_fixed_step);
+        _accumulator -= _fixed_step;
+        steps++;
+    }
+
+    // drop time we can't catch up with, or each frame takes even longer than the last one.
+    if (_accumulator >= _fixed_step) {
+        _accumulator = std::fmod(_accumulator, _fixed_step);
+    }
+
+    _current_world->render(_accumulator / _fixed_step);
+}
+
+void Game::dumpProfile() {
+#if NGIND_PROFILER
+    if ((*(*_global_settings)).HasMember("profiler-trace")) {
+        std::string filename = (*_global_settings)["profiler-trace"].GetString();
+        if (!filename.empty()) {
+            timer::Profiler::getInstance()->dump(filename);
+        }
     }
+#endif
 }
 
 void Game::loadWorld(const std::string& name) {
@@ -173,6 +324,7 @@ void Game::loadWorld(const std::string& name) {
 
     this->_current_world = this->_worlds[name];
     this->_worlds[name]->loadObjects();
+    _accumulator = 0.0f;
 }
 
 void Game::loadWorld(resources::ConfigResource* config) {
@@ -184,6 +336,7 @@ void Game::loadWorld(resources::ConfigResource* config) {
 
     this->_current_world = this->_worlds[name];
     this->_worlds[name]->loadObjects();
+    _accumulator = 0.0f;
 }
 
 void Game::destroyWorld(const std::string& name) {
@@ -210,6 +363,7 @@ void Game::popAndLoadWorld(const bool& has_destroy_current = true) {
         auto destroy_name = this->_current_world->getName();
         this->_current_world = this->_stack.top();
         this->_stack.pop();
+        _accumulator = 0.0f;
 
         if (has_destroy_current) {
             destroyWorld(destroy_name);
@@ -234,6 +388,7 @@ void Game::setFullScreen(bool enable) {
 }
 
 void Game::update(float delta) {
+    NGIND_PROFILE_ZONE("Game::update");
     ui::EventSystem::getInstance()->update();
     this->_current_world->update(delta);
     script::Observer::getInstance()->update();
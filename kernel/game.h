@@ -130,6 +130,25 @@ private:
      */
     void update(float delta);
 
+    /**
+     * Run a fixed number of frames with fixed delta and no frame limit, then report
+     * frame times. It's used by benchmarks in headless mode.
+     * @param delta: time passed in each frame
+     */
+    void runHeadless(const float& delta);
+
+    /**
+     * Write profiler zones into the trace file named by "profiler-trace" in global settings, if any. It does nothing if NGIND_PROFILER is 0.
+     */
+    void dumpProfile();
+
+    /**
+     * Advance the simulation by time passed in last frame and send rendering commands. In fixed
+     * timestep mode, the world is updated by fixed steps and rendered between the last two states.
+     * @param duration: time passed in last frame
+     */
+    void simulate(const float& duration);
+
     /**
      * Instance of game manager
      */
@@ -179,6 +198,21 @@ private:
      * Next world to show.
      */
     std::string _next_world;
+
+    /**
+     * Duration of a fixed step in second, or 0 if the world is updated by frame time
+     */
+    float _fixed_step;
+
+    /**
+     * Max number of fixed steps in a frame. Time exceeding it is dropped
+     */
+    size_t _max_steps;
+
+    /**
+     * Time not simulated yet in fixed timestep mode. It starts from 0 in each world
+     */
+    float _accumulator;
 };
 
 NGIND_LUA_BRIDGE_REGISTRATION(Input) {
@@ -23,6 +23,7 @@
 
 #include "visual_logger.h"
 #include "memory/memory_pool.h"
+#include "rendering/renderer.h"
 
 namespace ngind::log {
 VisualLogger* VisualLogger::_instance = nullptr;
@@ -65,7 +66,7 @@ void VisualLogger::enable() {
 
         _entity = memory::MemoryPool::getInstance()->create<objects::EntityObject>();
         _entity->addReference();
-        _entity->setZOrder(999);
+        _entity->setZOrder(rendering::Renderer::OVERLAY_Z_ORDER);
         _entity->setAnchor({0, 0});
         _entity->setPosition({0 - camera_pos.x + camera_size.x / 2, camera_pos.y - camera_size.y / 2});
         _entity->setScale({1, 1});
@@ -97,7 +98,7 @@ void VisualLogger::draw() {
         _entity->setPosition({0 + camera_pos.x - camera_size.x / 2, camera_pos.y + camera_size.y / 2});
 
         _label->setText(_text);
-        _entity->update(0);
+        _entity->render(1.0f);
     }
 }
 
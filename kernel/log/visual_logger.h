@@ -85,6 +85,17 @@ public:
         }
     }
 
+    /**
+     * Update variable's text in the logger.
+     * @param key: name of the variable
+     * @param value: variable's text
+     */
+    inline void updateVariable(const std::string& key, const std::string& value) {
+        if (_var.find(key) != _var.end()) {
+            _var[key] = value;
+        }
+    }
+
     /**
      * Remove a variable from the logger.
      * @param key: name of the variable
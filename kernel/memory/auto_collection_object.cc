@@ -28,18 +28,33 @@
 
 namespace ngind::memory {
 
-AutoCollectionObject::AutoCollectionObject() : _sustain(0) {
+AutoCollectionObject::AutoCollectionObject() : _sustain(0), _pending(false), _promoted(false), _index(NOT_IN_POOL), _census(nullptr) {
 }
 
 void AutoCollectionObject::removeReference() {
+#if NGIND_THREAD_SAFE_MEMORY
+    auto sustain = this->_sustain.load(std::memory_order_relaxed);
+    do {
+        if (sustain == 0) {
+            return;
+        }
+    } while (!this->_sustain.compare_exchange_weak(sustain, sustain - 1, std::memory_order_acq_rel));
+
+    if (sustain == 1) {
+#else
     if (this->_sustain == 0) {
         return;
     }
 
     this->_sustain--;
     if (this->_sustain == 0) {
-        MemoryPool::getInstance()->setFlag();
+#endif
+        MemoryPool::getInstance()->release(this);
     }
 }
 
+void AutoCollectionObject::promote() {
+    MemoryPool::getInstance()->promote(this);
+}
+
 } // namespace ngind::memory
\ No newline at end of file
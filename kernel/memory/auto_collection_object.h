@@ -27,8 +27,16 @@
 #define NGIND_AUTO_COLLECTION_OBJECT_H
 
 #include "script/lua_registration.h"
+#include "settings.h"
+
+#if NGIND_THREAD_SAFE_MEMORY
+#include <atomic>
+#endif
 
 namespace ngind::memory {
+class MemoryPool;
+struct Census;
+
 /**
  * This class enables object to recycle itself if there is no reference
  * of it. Notably this class is not an actual "object" and is not inherited from
@@ -52,15 +60,26 @@ public:
         // MUX>>>DEMUX
         // Can't you understand me?
         // I'm not mine NAND I'm not yours
+#if NGIND_THREAD_SAFE_MEMORY
+        this->_sustain.fetch_add(1, std::memory_order_relaxed);
+#else
         this->_sustain++;
+#endif
     }
 
     /**
-     * Decrease the number of reference to this. If the number is equal to 0,
-     * remove itself from the memory pool
+     * Decrease the number of reference to this. If the number is equal to 0, it's
+     * released by the memory pool at the end of frame unless it's referred again.
      */
     void removeReference();
 
+    /**
+     * Move this object out of its arena, so it isn't destroyed with the arena and lives
+     * until it's not referred. Objects it owns should be promoted as well: an owner destroyed
+     * with its arena doesn't remove its references.
+     */
+    virtual void promote();
+
     /**
      * Get the number of reference.
      * @return int, the number of reference
@@ -69,11 +88,41 @@ public:
         return this->_sustain;
     }
 
+    friend class MemoryPool;
 private:
     /**
      * The number of reference.
      */
+#if NGIND_THREAD_SAFE_MEMORY
+    std::atomic<int> _sustain;
+#else
     int _sustain;
+#endif
+
+    /**
+     * True if it's waiting to be released by memory pool
+     */
+    bool _pending;
+
+    /**
+     * True if it's moved out of its arena and has global lifetime
+     */
+    bool _promoted;
+
+    /**
+     * Index in memory pool, or NOT_IN_POOL if it's not created by memory pool
+     */
+    size_t _index;
+
+    /**
+     * Allocation counters of its type, or nullptr if it's not counted by memory pool
+     */
+    Census* _census;
+
+    /**
+     * Index of objects not created by memory pool
+     */
+    static constexpr size_t NOT_IN_POOL = static_cast<size_t>(-1);
 };
 
 NGIND_LUA_BRIDGE_REGISTRATION(AutoCollectionObject) {
@@ -83,6 +132,7 @@ luabridge::getGlobalNamespace(script::LuaState::getInstance()->getState())
                 .addFunction("addReference", &AutoCollectionObject::addReference)
                 .addFunction("removeReference", &AutoCollectionObject::removeReference)
                 .addFunction("getSustain", &AutoCollectionObject::getSustain)
+                .addFunction("promote", &AutoCollectionObject::promote)
             .endClass()
         .endNamespace();
 }
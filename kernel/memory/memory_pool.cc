@@ -27,8 +27,15 @@
 
 #include <iostream>
 #include <cstring>
+#include <cstdlib>
+#include <chrono>
+#include <map>
+#include <algorithm>
+#include <sstream>
+#include <cxxabi.h>
 
 #include "log/logger_factory.h"
+#include "timer/profiler.h"
 
 namespace ngind::memory {
 MemoryPool* MemoryPool::_instance = nullptr;
@@ -53,51 +60,446 @@ void MemoryPool::destroyInstance() {
 }
 
 void MemoryPool::clear() {
-    if (!_dirty) {
+    NGIND_PROFILE_ZONE("MemoryPool::clear");
+#if NGIND_THREAD_SAFE_MEMORY
+    collectRemote();
+#endif
+    if (_pending.empty() && _dying.empty()) {
         return;
     }
 
-    auto tbm = _pool.end();
-    for (auto it = _pool.begin(); it != _pool.end(); ++it) {
-        if (tbm != _pool.end()) {
-            _pool.erase(tbm);
-            tbm = _pool.end();
+#if NGIND_PROFILER
+    auto start = timer::Profiler::clock_type::now();
+#endif
+    [[maybe_unused]] size_t released = 0;
+
+    // destroying objects may release more objects or arenas, so repeat until nothing is left.
+    while (!_pending.empty() || !_dying.empty()) {
+        // destructors may release more objects and append them, so index the list instead of iterating.
+        for (size_t i = 0; i < _pending.size(); i++) {
+            auto temp = _pending[i];
+            temp->_pending = false;
+            if (temp->getSustain() > 0 || getRegion(temp)->_dying) {
+                continue; // referred again before the end of frame, or destroyed with its arena
+            }
+
+            free(temp);
+            released++;
+        }
+
+        _pending.clear();
+
+        auto dying = std::move(_dying);
+        _dying.clear();
+        for (auto arena : dying) {
+            released += tearDown(arena);
         }
+    }
+
+#if NGIND_PROFILER
+    std::chrono::duration<float, std::milli> used = timer::Profiler::clock_type::now() - start;
+    auto profiler = timer::Profiler::getInstance();
+    profiler->counter("released objects", static_cast<float>(released));
+    profiler->counter("release time", used.count());
+#endif
+}
 
-        auto temp = *it;
-        if (temp->getSustain() == 0) {
-            temp->~AutoCollectionObject();
-            ::operator delete(temp);
-            *it = nullptr;
-            tbm = it;
+MemoryPool::MemoryPool() : _global(), _current(nullptr), _tearing(nullptr) {
+#if NGIND_THREAD_SAFE_MEMORY
+    _main_thread = std::this_thread::get_id();
+#endif
+}
+
+MemoryPool::~MemoryPool() {
+    reportLeaks();
+
+    _current = nullptr;
+    for (size_t i = 0; i < _global._objects.size(); i++) {
+        uncount(_global._objects[i]);
+        _global._objects[i]->~AutoCollectionObject();
+    }
+
+    _global._objects.clear();
+    for (auto arena : _arenas) {
+        arena->_dying = true;
+        for (size_t i = 0; i < arena->_objects.size(); i++) {
+            uncount(arena->_objects[i]);
+            arena->_objects[i]->~AutoCollectionObject();
         }
     }
 
-    if (tbm != _pool.end()) {
-        _pool.erase(tbm);
+    for (auto arena : _arenas) {
+        delete arena;
     }
 
-    _dirty = false;
+    _arenas.clear();
+    _dying.clear();
+    _pending.clear();
+
+#if NGIND_THREAD_SAFE_MEMORY
+    // pieces cached by the main thread go with the global arena.
+    _cache.owner = nullptr;
+#endif
 }
 
-MemoryPool::MemoryPool() : _dirty(false) {
+MemoryPool::Arena* MemoryPool::createArena() {
+    auto arena = new Arena();
+    _arenas.push_back(arena);
+    return arena;
 }
 
-MemoryPool::~MemoryPool() {
-    for (auto* item : _pool) {
-        item->~AutoCollectionObject();
-        ::operator delete(item);
+void MemoryPool::destroyArena(Arena* arena) {
+    if (arena == nullptr || arena->_dying) {
+        return;
+    }
+
+    if (_current == arena) {
+        _current = nullptr;
+    }
+
+    arena->_dying = true;
+    _dying.push_back(arena);
+}
+
+void MemoryPool::promote(AutoCollectionObject* object) {
+    auto arena = getRegion(object);
+    if (arena == &_global || arena->_dying) {
+        return;
+    }
+
+    untrack(object);
+    object->_promoted = true;
+    object->_index = _global._objects.size();
+    _global._objects.push_back(object);
+    arena->_promoted++;
+}
+
+SlabAllocator::Statistics MemoryPool::getStatistics() const {
+#if NGIND_THREAD_SAFE_MEMORY
+    std::lock_guard<std::mutex> lock{_mutex};
+#endif
+    auto statistics = _global._allocator.getStatistics();
+    for (auto arena : _arenas) {
+        auto arena_statistics = arena->_allocator.getStatistics();
+        statistics.chunks += arena_statistics.chunks;
+        statistics.reserved += arena_statistics.reserved;
+        statistics.used += arena_statistics.used;
+        statistics.fragmented += arena_statistics.fragmented;
+    }
+
+    return statistics;
+}
+
+SlabAllocator::Statistics MemoryPool::getStatistics(const size_t& index) const {
+#if NGIND_THREAD_SAFE_MEMORY
+    std::lock_guard<std::mutex> lock{_mutex};
+#endif
+    auto statistics = _global._allocator.getStatistics(index);
+    for (auto arena : _arenas) {
+        auto arena_statistics = arena->_allocator.getStatistics(index);
+        statistics.chunks += arena_statistics.chunks;
+        statistics.reserved += arena_statistics.reserved;
+        statistics.used += arena_statistics.used;
+        statistics.fragmented += arena_statistics.fragmented;
+    }
+
+    return statistics;
+}
+
+void MemoryPool::dumpCensus(const std::string& filename) const {
+    auto logger = log::LoggerFactory::getInstance()->getLogger(filename, log::LogLevel::LOG_LEVEL_INFO);
+    std::vector<const Census*> census;
+    census.reserve(_census.size());
+    for (const auto& [type, counters] : _census) {
+        census.push_back(&counters);
+    }
+
+    std::sort(census.begin(), census.end(), [](const Census* a, const Census* b) {
+        return a->bytes > b->bytes;
+    });
+
+    size_t count = 0, bytes = 0;
+    for (auto counters : census) {
+        std::stringstream stream;
+        stream << counters->name << ": " << counters->count << " alive, "
+               << counters->bytes << " bytes, peak " << counters->peak << ", "
+               << counters->created << " created";
+        logger->log(stream.str());
+        count += counters->count;
+        bytes += counters->bytes;
+    }
+
+    std::stringstream total;
+    total << "total: " << count << " alive, " << bytes << " bytes";
+    logger->log(total.str());
+
+    auto report = [&logger, this](const std::string& name, const Arena* arena) {
+#if NGIND_THREAD_SAFE_MEMORY
+        std::lock_guard<std::mutex> lock{_mutex};
+#endif
+        auto statistics = arena->_allocator.getStatistics();
+        std::stringstream stream;
+        stream << name << ": " << arena->_objects.size() << " objects, "
+               << statistics.used << "/" << statistics.reserved << " bytes";
+        logger->log(stream.str());
+    };
+
+    report("global", &_global);
+    for (size_t i = 0; i < _arenas.size(); i++) {
+        report("arena " + std::to_string(i), _arenas[i]);
+    }
+
+    logger->flush();
+}
+
+void MemoryPool::reportLeaks() const {
+    std::map<std::string, size_t> leaks;
+    auto find = [&leaks](const Arena* arena) {
+        for (auto object : arena->_objects) {
+            if (object->getSustain() > 0) {
+                leaks[(object->_census == nullptr) ? "unknown" : object->_census->name]++;
+            }
+        }
+    };
+
+    find(&_global);
+    for (auto arena : _arenas) {
+        find(arena);
+    }
+
+    if (leaks.empty()) {
+        return;
+    }
+
+    auto logger = log::LoggerFactory::getInstance()->getLogger("memory.log", log::LogLevel::LOG_LEVEL_INFO);
+    for (const auto& [name, number] : leaks) {
+        logger->log("leak: " + std::to_string(number) + " " + name + " still referred.");
+    }
+
+    logger->flush();
+}
+
+void MemoryPool::reportForeign() {
+    auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+    logger->log("Can't create an object next to an object not created by memory pool.");
+    logger->flush();
+}
+
+void MemoryPool::track(AutoCollectionObject* object, const std::type_info& type, const size_t& size) {
+#if NGIND_THREAD_SAFE_MEMORY
+    if (std::this_thread::get_id() != _main_thread) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _remote_created.push_back({object, &type, size});
+        return;
+    }
+#endif
+    count(object, type, size);
+    auto arena = getRegion(object);
+    object->_index = arena->_objects.size();
+    arena->_objects.push_back(object);
+
+    object->_pending = true;
+    _pending.push_back(object);
+}
+
+void MemoryPool::count(AutoCollectionObject* object, const std::type_info& type, const size_t& size) {
+    auto& census = _census[std::type_index{type}];
+    if (census.created == 0) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        census.name = (status == 0 && demangled != nullptr) ? demangled : type.name();
+        census.size = size;
+        std::free(demangled);
+    }
+
+    census.count++;
+    census.created++;
+    census.bytes += size;
+    census.peak = std::max(census.peak, census.count);
+    object->_census = &census;
+}
+
+void MemoryPool::untrack(AutoCollectionObject* object) {
+    auto& objects = getRegion(object)->_objects;
+    auto last = objects.back();
+    objects[object->_index] = last;
+    last->_index = object->_index;
+    objects.pop_back();
+}
+
+void MemoryPool::free(AutoCollectionObject* object) {
+    untrack(object);
+
+    auto arena = static_cast<Arena*>(SlabAllocator::getOwner(object));
+    bool promoted = object->_promoted;
+    uncount(object);
+    object->~AutoCollectionObject();
+#if NGIND_THREAD_SAFE_MEMORY
+    if (arena == &_global) {
+        deallocateShared(object);
+    }
+    else {
+        arena->_allocator.deallocate(object);
+    }
+#else
+    arena->_allocator.deallocate(object);
+#endif
+
+    if (promoted) {
+        arena->_promoted--;
+        if (arena->_dying && arena->_promoted == 0) {
+            deleteArena(arena);
+        }
+    }
+}
+
+size_t MemoryPool::tearDown(Arena* arena) {
+    NGIND_PROFILE_ZONE("MemoryPool::tearDown");
+
+    // objects of a dying arena are never released one by one, so memory stays valid while
+    // destructors run and refer to each other.
+    auto& objects = arena->_objects;
+    _tearing = arena;
+    for (size_t i = 0; i < objects.size(); i++) {
+        uncount(objects[i]);
+        objects[i]->~AutoCollectionObject();
+    }
+
+    _tearing = nullptr;
+
+    auto number = objects.size();
+    if (arena->_promoted == 0) {
+        deleteArena(arena);
+    }
+    else {
+        for (auto object : objects) {
+            arena->_allocator.deallocate(object);
+        }
+
+        objects.clear();
+    }
+
+    return number;
+}
+
+void MemoryPool::deleteArena(Arena* arena) {
+    for (auto it = _arenas.begin(); it != _arenas.end(); ++it) {
+        if (*it == arena) {
+            _arenas.erase(it);
+            break;
+        }
     }
 
-    _pool.clear();
+    delete arena;
 }
 
-AutoCollectionObject* MemoryPool::allocate(const size_t& size) {
-    auto p = ::operator new(size);
+void* MemoryPool::allocate(const size_t& size) {
+#if NGIND_THREAD_SAFE_MEMORY
+    // arenas belong to the main thread, so other threads always create global objects.
+    void* p = nullptr;
+    if (_current == nullptr || std::this_thread::get_id() != _main_thread) {
+        p = allocateShared(size);
+    }
+    else {
+        p = _current->_allocator.allocate(size);
+    }
+#else
+    auto arena = (_current == nullptr) ? &_global : _current;
+    auto p = arena->_allocator.allocate(size);
+#endif
     std::memset(p, 0, size);
-    auto ao = reinterpret_cast<AutoCollectionObject*>(p);
-    _pool.push_back(ao);
-    return ao;
+    return p;
+}
+
+#if NGIND_THREAD_SAFE_MEMORY
+thread_local MemoryPool::Cache MemoryPool::_cache;
+
+MemoryPool::Cache::~Cache() {
+    if (owner != nullptr && owner == MemoryPool::_instance) {
+        std::lock_guard<std::mutex> lock{owner->_mutex};
+        for (auto& list : pieces) {
+            for (auto p : list) {
+                owner->_global._allocator.deallocate(p);
+            }
+        }
+    }
+}
+
+MemoryPool::Cache& MemoryPool::getCache() {
+    if (_cache.owner != this) {
+        // pieces of a destroyed pool are gone with it.
+        for (auto& list : _cache.pieces) {
+            list.clear();
+        }
+
+        _cache.owner = this;
+    }
+
+    return _cache;
+}
+
+void* MemoryPool::allocateShared(const size_t& size) {
+    auto index = (size == 0) ? 0 : (size - 1) / SlabAllocator::CLASS_GRANULARITY;
+    if (index >= SlabAllocator::CLASSES_NUMBER) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _global._allocator.allocate(size);
+    }
+
+    auto& pieces = getCache().pieces[index];
+    if (pieces.empty()) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        for (size_t i = 0; i < CACHE_BATCH; i++) {
+            pieces.push_back(_global._allocator.allocate((index + 1) * SlabAllocator::CLASS_GRANULARITY));
+        }
+    }
+
+    auto p = pieces.back();
+    pieces.pop_back();
+    return p;
+}
+
+void MemoryPool::deallocateShared(void* p) {
+    auto index = SlabAllocator::getClassIndex(p);
+    if (index >= SlabAllocator::CLASSES_NUMBER) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _global._allocator.deallocate(p);
+        return;
+    }
+
+    auto& pieces = getCache().pieces[index];
+    pieces.push_back(p);
+    if (pieces.size() >= 2 * CACHE_BATCH) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        for (size_t i = 0; i < CACHE_BATCH; i++) {
+            _global._allocator.deallocate(pieces.back());
+            pieces.pop_back();
+        }
+    }
+}
+
+void MemoryPool::collectRemote() {
+    std::vector<Creation> created;
+    std::vector<AutoCollectionObject*> released;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        created.swap(_remote_created);
+        released.swap(_remote_released);
+    }
+
+    // the creating thread may not have referred them yet, so they are released only after
+    // their references drop to zero, instead of at the end of this frame.
+    for (auto [object, type, size] : created) {
+        count(object, *type, size);
+        object->_index = _global._objects.size();
+        _global._objects.push_back(object);
+    }
+
+    for (auto object : released) {
+        if (object->getSustain() == 0) {
+            release(object);
+        }
+    }
 }
+#endif
 
 } // namespace ngind
\ No newline at end of file
@@ -28,17 +28,128 @@
 
 #include <set>
 #include <memory>
-#include <list>
+#include <vector>
+#include <string>
+#include <typeinfo>
+#include <typeindex>
+#include <unordered_map>
 
 #include "auto_collection_object.h"
+#include "slab_allocator.h"
+#include "settings.h"
+
+#if NGIND_THREAD_SAFE_MEMORY
+#include <mutex>
+#include <thread>
+#endif
 
 namespace ngind::memory {
+/**
+ * Allocation counters of an object type created by memory pool.
+ */
+struct Census {
+    /**
+     * Readable name of type
+     */
+    std::string name;
+
+    /**
+     * Size of an object in bytes
+     */
+    size_t size;
+
+    /**
+     * Number of objects alive
+     */
+    size_t count;
+
+    /**
+     * Memory used by objects alive in bytes
+     */
+    size_t bytes;
+
+    /**
+     * Max number of objects alive at the same time
+     */
+    size_t peak;
+
+    /**
+     * Number of objects created
+     */
+    size_t created;
+};
+
 /**
  * This class is used to manage auto collection object. You shouldn't
  * call this class. Inherit auto collection object instead.
+ *
+ * If NGIND_THREAD_SAFE_MEMORY is 1, objects can be created and released on any thread,
+ * but always with global lifetime. Objects created or released by other threads are handed
+ * to the main thread and collected in clear. An object created by another thread isn't released
+ * until its references drop to zero, so it must be referred at least once. The instance must be
+ * created on the main thread.
  */
 class MemoryPool {
 public:
+    /**
+     * Region of memory whose objects are destroyed together, e.g. objects loaded by a world.
+     * Objects in an arena can still be released one by one.
+     */
+    class Arena {
+    public:
+        Arena(const Arena&) = delete;
+        Arena& operator= (const Arena&) = delete;
+
+        friend class MemoryPool;
+    private:
+        Arena() : _allocator(this), _promoted(0), _dying(false) {}
+
+        ~Arena() = default;
+
+        /**
+         * Allocator holding memory of objects in this arena
+         */
+        SlabAllocator _allocator;
+
+        /**
+         * Objects alive in this arena. Each object keeps its index
+         */
+        std::vector<AutoCollectionObject*> _objects;
+
+        /**
+         * Number of promoted objects whose memory is still in this arena
+         */
+        size_t _promoted;
+
+        /**
+         * True if the arena is being destroyed
+         */
+        bool _dying;
+    };
+
+    /**
+     * Use an arena until the end of scope, even if an exception is thrown.
+     */
+    class ArenaScope {
+    public:
+        /**
+         * @param arena: the arena, or nullptr for global lifetime
+         */
+        explicit ArenaScope(Arena* arena) : _previous(MemoryPool::getInstance()->setArena(arena)) {}
+
+        ~ArenaScope() {
+            MemoryPool::getInstance()->setArena(_previous);
+        }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator= (const ArenaScope&) = delete;
+    private:
+        /**
+         * The arena used before
+         */
+        Arena* _previous;
+    };
+
     /**
      * Get instance of memory pool
      * @return MemoryPool*, the instance
@@ -56,19 +167,20 @@ public:
     void clear();
 
     /**
-     * Create an instance of given type.
+     * Create an instance of given type in current arena.
      * @tparam T: type of instance
      * @return T*, the instance
      */
     template<typename T, std::enable_if_t<std::is_base_of_v<AutoCollectionObject, T>, int> N = 0>
     T* create() {
         auto p = allocate(sizeof(T));
-        new(p) T();
-        return reinterpret_cast<T*>(p);
+        auto object = new(p) T();
+        track(object, typeid(T), sizeof(T));
+        return object;
     }
 
     /**
-     * Create an instance of given type and params.
+     * Create an instance of given type and params in current arena.
      * @tparam T: type of instance
      * @tparam P: type list of params
      * @param params: params
@@ -77,17 +189,130 @@ public:
     template<typename T, typename ...P, std::enable_if_t<std::is_base_of_v<AutoCollectionObject, T>, int> N = 0>
     T* create(P... params) {
         auto p = allocate(sizeof(T));
-        new(p) T(params...);
-        return reinterpret_cast<T*>(p);
+        auto object = new(p) T(params...);
+        track(object, typeid(T), sizeof(T));
+        return object;
     }
 
     /**
-     * Set dirty flag and when this frame ends unused memory would be cleaned.
+     * Create an instance of given type and params in the same arena as another object,
+     * e.g. rendering commands of a component.
+     * @tparam T: type of instance
+     * @tparam P: type list of params
+     * @param neighbour: the other object, which must be created by memory pool
+     * @param params: params
+     * @return T*, the instance, or nullptr if the other object isn't created by memory pool
      */
-    inline void setFlag() {
-        _dirty = true;
+    template<typename T, typename ...P, std::enable_if_t<std::is_base_of_v<AutoCollectionObject, T>, int> N = 0>
+    T* createNear(const AutoCollectionObject* neighbour, P... params) {
+        if (neighbour->_index == AutoCollectionObject::NOT_IN_POOL) {
+            reportForeign();
+            return nullptr;
+        }
+
+        auto region = getRegion(neighbour);
+        ArenaScope scope{(region == &_global || region->_dying) ? nullptr : region};
+        return create<T>(params...);
     }
 
+    /**
+     * Release an object at the end of this frame if nothing refers to it by then.
+     * Nothing happens if the object is not created by memory pool, or its arena is being destroyed.
+     * @param object: the object without reference
+     */
+    inline void release(AutoCollectionObject* object) {
+#if NGIND_THREAD_SAFE_MEMORY
+        if (std::this_thread::get_id() != _main_thread) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _remote_released.push_back(object);
+            return;
+        }
+#endif
+        if (object->_index != AutoCollectionObject::NOT_IN_POOL && !object->_pending && !getRegion(object)->_dying) {
+            object->_pending = true;
+            _pending.push_back(object);
+        }
+    }
+
+    /**
+     * Create an arena.
+     * @return Arena*, the new arena
+     */
+    Arena* createArena();
+
+    /**
+     * Create following objects in an arena.
+     * @param arena: the arena, or nullptr for global lifetime
+     * @return Arena*, the arena used before
+     */
+    inline Arena* setArena(Arena* arena) {
+        auto previous = _current;
+        _current = arena;
+        return previous;
+    }
+
+    /**
+     * Get the arena where objects are created.
+     * @return Arena*, current arena, or nullptr for global lifetime
+     */
+    inline Arena* getArena() const {
+        return _current;
+    }
+
+    /**
+     * Destroy all objects in an arena at the end of this frame, no matter they are referred or not,
+     * and release its memory at once. References to them from objects of other arenas are ignored.
+     * @param arena: the arena
+     */
+    void destroyArena(Arena* arena);
+
+    /**
+     * Move an object out of its arena, so it lives until it's not referred.
+     * @param object: the object
+     */
+    void promote(AutoCollectionObject* object);
+
+    /**
+     * Check if an object is being destroyed together with all objects of its arena. Objects it
+     * owns may have been destroyed already, so its destructor shouldn't touch them.
+     * @param object: the object being destroyed
+     * @return bool, true if it's destroyed with its arena
+     */
+    inline bool isTearingDown(const AutoCollectionObject* object) const {
+        if (object->_index == AutoCollectionObject::NOT_IN_POOL || object->_promoted) {
+            return false;
+        }
+
+        return _tearing != nullptr && SlabAllocator::getOwner(object) == _tearing;
+    }
+
+    /**
+     * Get occupancy of memory used by objects.
+     * @return SlabAllocator::Statistics, occupancy of all size classes
+     */
+    SlabAllocator::Statistics getStatistics() const;
+
+    /**
+     * Get occupancy of memory used by objects of a size class.
+     * @param index: index of size class
+     * @return SlabAllocator::Statistics, occupancy of the size class
+     */
+    SlabAllocator::Statistics getStatistics(const size_t& index) const;
+
+    /**
+     * Get allocation counters of each type.
+     * @return const std::unordered_map<std::type_index, Census>&, counters of types created so far
+     */
+    inline const std::unordered_map<std::type_index, Census>& getCensus() const {
+        return _census;
+    }
+
+    /**
+     * Write allocation counters of each type and memory used by each arena into a log file.
+     * @param filename: name of log file
+     */
+    void dumpCensus(const std::string& filename) const;
+
 private:
     /**
      * The instance of memory pool
@@ -95,26 +320,226 @@ private:
     static MemoryPool* _instance;
 
     /**
-     * Should pool be cleaned.
+     * Allocate a piece of memory in current arena
+     * @param size: size of memory piece
+     * @return void*, new memory area
+     */
+    void* allocate(const size_t& size);
+
+    /**
+     * Objects of global lifetime
      */
-    bool _dirty;
+    Arena _global;
 
     /**
-     * Allocate a piece of memory from pool
+     * Arenas alive, including those being destroyed and waiting for promoted objects
+     */
+    std::vector<Arena*> _arenas;
+
+    /**
+     * Arena where objects are created, or nullptr for global lifetime
+     */
+    Arena* _current;
+
+    /**
+     * Arenas waiting to be destroyed
+     */
+    std::vector<Arena*> _dying;
+
+    /**
+     * Arena whose objects are being destroyed, or nullptr
+     */
+    Arena* _tearing;
+
+    /**
+     * Objects without reference, waiting to be released
+     */
+    std::vector<AutoCollectionObject*> _pending;
+
+    /**
+     * Allocation counters of each type
+     */
+    std::unordered_map<std::type_index, Census> _census;
+
+#if NGIND_THREAD_SAFE_MEMORY
+    /**
+     * Free pieces of global arena kept by a thread, so most allocations don't lock.
+     */
+    struct Cache {
+        /**
+         * Memory pool owning the pieces
+         */
+        MemoryPool* owner = nullptr;
+
+        /**
+         * Free pieces of each size class
+         */
+        std::vector<void*> pieces[SlabAllocator::CLASSES_NUMBER];
+
+        ~Cache();
+    };
+
+    /**
+     * Number of pieces moved between a cache and global arena at once
+     */
+    static constexpr size_t CACHE_BATCH = 32;
+
+    /**
+     * Cache of current thread
+     */
+    static thread_local Cache _cache;
+
+    /**
+     * The main thread, where objects are collected
+     */
+    std::thread::id _main_thread;
+
+    /**
+     * Mutex for global arena's allocator and objects handed from other threads
+     */
+    mutable std::mutex _mutex;
+
+    /**
+     * Object created by another thread
+     */
+    struct Creation {
+        /**
+         * The object
+         */
+        AutoCollectionObject* object;
+
+        /**
+         * Type of object
+         */
+        const std::type_info* type;
+
+        /**
+         * Size of object in bytes
+         */
+        size_t size;
+    };
+
+    /**
+     * Objects created by other threads, not tracked yet
+     */
+    std::vector<Creation> _remote_created;
+
+    /**
+     * Objects released by other threads
+     */
+    std::vector<AutoCollectionObject*> _remote_released;
+
+    /**
+     * Get the cache of current thread for this pool.
+     * @return Cache&, the cache
+     */
+    Cache& getCache();
+
+    /**
+     * Allocate a piece of global arena through the cache of current thread.
      * @param size: size of memory piece
-     * @return AutoCollectionObject*, new memory area
+     * @return void*, new memory area
+     */
+    void* allocateShared(const size_t& size);
+
+    /**
+     * Give back a piece of global arena through the cache of current thread.
+     * @param p: the piece
+     */
+    void deallocateShared(void* p);
+
+    /**
+     * Track objects created and release objects released by other threads.
+     */
+    void collectRemote();
+#endif
+
+    /**
+     * Get the arena whose objects list holds an object.
+     * @param object: the object
+     * @return Arena*, the arena
+     */
+    inline Arena* getRegion(const AutoCollectionObject* object) {
+        return object->_promoted ? &_global : static_cast<Arena*>(SlabAllocator::getOwner(object));
+    }
+
+    /**
+     * Start managing a new object. It's released at the end of frame if it's not referred.
+     * @param object: the new object
+     * @param type: type of object
+     * @param size: size of object in bytes
+     */
+    void track(AutoCollectionObject* object, const std::type_info& type, const size_t& size);
+
+    /**
+     * Count a new object in allocation counters of its type.
+     * @param object: the new object
+     * @param type: type of object
+     * @param size: size of object in bytes
+     */
+    void count(AutoCollectionObject* object, const std::type_info& type, const size_t& size);
+
+    /**
+     * Remove an object being destroyed from allocation counters.
+     * @param object: the object
+     */
+    inline void uncount(AutoCollectionObject* object) {
+        auto census = object->_census;
+        if (census != nullptr) {
+            census->count--;
+            census->bytes -= census->size;
+        }
+    }
+
+    /**
+     * Write objects still referred when memory pool is destroyed into log file.
+     */
+    void reportLeaks() const;
+
+    /**
+     * Log an object placed next to an object not created by memory pool.
      */
-    AutoCollectionObject* allocate(const size_t& size);
+    static void reportForeign();
 
     /**
-     * A RB-Tree to manage objects
+     * Remove an object from objects list of its arena.
+     * @param object: the object
      */
-    std::list<AutoCollectionObject*> _pool;
+    void untrack(AutoCollectionObject* object);
+
+    /**
+     * Destroy an object and give its memory back.
+     * @param object: the object
+     */
+    void free(AutoCollectionObject* object);
+
+    /**
+     * Destroy all objects in an arena.
+     * @param arena: the arena
+     * @return size_t, number of objects destroyed
+     */
+    size_t tearDown(Arena* arena);
+
+    /**
+     * Release memory of an arena.
+     * @param arena: the arena
+     */
+    void deleteArena(Arena* arena);
 
     MemoryPool();
 
     ~MemoryPool();
 };
+
+NGIND_LUA_BRIDGE_REGISTRATION(MemoryPool) {
+    luabridge::getGlobalNamespace(script::LuaState::getInstance()->getState())
+        .beginNamespace("engine")
+            .beginClass<MemoryPool>("MemoryPool")
+                .addStaticFunction("getInstance", &MemoryPool::getInstance)
+                .addFunction("dumpCensus", &MemoryPool::dumpCensus)
+            .endClass()
+        .endNamespace();
+}
 } // namespace ngind::memory
 
 #endif //NGIND_MEMORY_POOL_H
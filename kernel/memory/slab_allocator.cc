@@ -0,0 +1,171 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file slab_allocator.cc
+
+
+#include "slab_allocator.h"
+
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+
+namespace ngind::memory {
+
+SlabAllocator::SlabAllocator(void* owner) : _classes{}, _owner(owner), _pieces(0) {
+}
+
+SlabAllocator::~SlabAllocator() {
+    for (auto& size_class : _classes) {
+        for (auto chunk : size_class.chunks) {
+            std::free(chunk);
+        }
+
+        size_class.chunks.clear();
+        size_class.free = nullptr;
+    }
+
+    for (auto chunk : _large) {
+        std::free(chunk);
+    }
+
+    _large.clear();
+}
+
+SlabAllocator::ChunkHeader* SlabAllocator::allocateChunk(const size_t& size, const size_t& index) {
+    auto chunk = reinterpret_cast<ChunkHeader*>(std::aligned_alloc(CHUNK_SIZE, size));
+    if (chunk == nullptr) {
+        throw std::bad_alloc{};
+    }
+
+    chunk->index = index;
+    chunk->used = 0;
+    chunk->size = size;
+    chunk->owner = _owner;
+    return chunk;
+}
+
+void SlabAllocator::grow(const size_t& index) {
+    auto chunk = allocateChunk(CHUNK_SIZE, index);
+    auto& size_class = _classes[index];
+    size_class.chunks.push_back(chunk);
+
+    auto piece_size = getPieceSize(index);
+    auto begin = reinterpret_cast<char*>(chunk) + HEADER_SIZE;
+    auto number = (CHUNK_SIZE - HEADER_SIZE) / piece_size;
+
+    // link pieces backwards so they are handed out in address order.
+    for (size_t i = number; i > 0; i--) {
+        auto piece = reinterpret_cast<FreePiece*>(begin + (i - 1) * piece_size);
+        piece->next = size_class.free;
+        size_class.free = piece;
+    }
+}
+
+void* SlabAllocator::allocate(const size_t& size) {
+    _pieces++;
+    auto index = (size == 0) ? 0 : (size - 1) / CLASS_GRANULARITY;
+    if (index >= CLASSES_NUMBER) {
+        auto chunk_size = (size + HEADER_SIZE + CHUNK_SIZE - 1) / CHUNK_SIZE * CHUNK_SIZE;
+        auto chunk = allocateChunk(chunk_size, CLASSES_NUMBER);
+        chunk->used = 1;
+        _large.push_back(chunk);
+        return reinterpret_cast<char*>(chunk) + HEADER_SIZE;
+    }
+
+    auto& size_class = _classes[index];
+    if (size_class.free == nullptr) {
+        grow(index);
+    }
+
+    auto piece = size_class.free;
+    size_class.free = piece->next;
+
+    auto chunk = reinterpret_cast<ChunkHeader*>(reinterpret_cast<uintptr_t>(piece) & ~(CHUNK_SIZE - 1));
+    chunk->used++;
+    return piece;
+}
+
+void SlabAllocator::deallocate(void* p) {
+    if (p == nullptr) {
+        return;
+    }
+
+    _pieces--;
+    auto chunk = reinterpret_cast<ChunkHeader*>(reinterpret_cast<uintptr_t>(p) & ~(CHUNK_SIZE - 1));
+    if (chunk->index == CLASSES_NUMBER) {
+        for (auto it = _large.begin(); it != _large.end(); ++it) {
+            if (*it == chunk) {
+                *it = _large.back();
+                _large.pop_back();
+                break;
+            }
+        }
+
+        std::free(chunk);
+        return;
+    }
+
+    auto piece = reinterpret_cast<FreePiece*>(p);
+    auto& size_class = _classes[chunk->index];
+    piece->next = size_class.free;
+    size_class.free = piece;
+    chunk->used--;
+}
+
+SlabAllocator::Statistics SlabAllocator::getStatistics(const size_t& index) const {
+    Statistics statistics{getPieceSize(index), 0, 0, 0, 0};
+    auto piece_size = getPieceSize(index);
+    auto capacity = (CHUNK_SIZE - HEADER_SIZE) / piece_size;
+    for (auto chunk : _classes[index].chunks) {
+        statistics.chunks++;
+        statistics.reserved += chunk->size;
+        statistics.used += chunk->used * piece_size;
+        if (chunk->used > 0) {
+            statistics.fragmented += (capacity - chunk->used) * piece_size;
+        }
+    }
+
+    return statistics;
+}
+
+SlabAllocator::Statistics SlabAllocator::getStatistics() const {
+    Statistics statistics{0, 0, 0, 0, 0};
+    for (size_t i = 0; i < CLASSES_NUMBER; i++) {
+        auto class_statistics = getStatistics(i);
+        statistics.chunks += class_statistics.chunks;
+        statistics.reserved += class_statistics.reserved;
+        statistics.used += class_statistics.used;
+        statistics.fragmented += class_statistics.fragmented;
+    }
+
+    for (auto chunk : _large) {
+        statistics.chunks++;
+        statistics.reserved += chunk->size;
+        statistics.used += chunk->size - HEADER_SIZE;
+    }
+
+    return statistics;
+}
+
+} // namespace ngind::memory
@@ -0,0 +1,251 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file slab_allocator.h
+
+
+#ifndef NGIND_SLAB_ALLOCATOR_H
+#define NGIND_SLAB_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ngind::memory {
+
+/**
+ * Allocator carving memory pieces of the same size class out of large chunks. Free pieces
+ * of each size class are kept in a free list, so allocating is a pop and deallocating is a push.
+ * Chunks are aligned to their size, so the chunk of a piece is found by its address. Pieces larger
+ * than the biggest size class get a chunk of their own. It's not thread safe.
+ */
+class SlabAllocator {
+public:
+    /**
+     * Size and alignment of each chunk
+     */
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * Difference between two neighbouring size classes, also the alignment of pieces
+     */
+    static constexpr size_t CLASS_GRANULARITY = 16;
+
+    /**
+     * Number of size classes. Pieces up to CLASS_GRANULARITY * CLASSES_NUMBER bytes are carved from slabs
+     */
+    static constexpr size_t CLASSES_NUMBER = 64;
+
+    /**
+     * Occupancy of a size class, or of all classes.
+     */
+    struct Statistics {
+        /**
+         * Size of pieces in bytes, or 0 for all classes
+         */
+        size_t piece_size;
+
+        /**
+         * Number of chunks
+         */
+        size_t chunks;
+
+        /**
+         * Bytes reserved by chunks
+         */
+        size_t reserved;
+
+        /**
+         * Bytes of pieces in use
+         */
+        size_t used;
+
+        /**
+         * Bytes of free pieces in chunks that still have pieces in use. They can't be returned to system
+         */
+        size_t fragmented;
+    };
+
+    /**
+     * @param owner: object owning this allocator, which can be found by addresses of pieces
+     */
+    explicit SlabAllocator(void* owner = nullptr);
+
+    ~SlabAllocator();
+
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator= (const SlabAllocator&) = delete;
+
+    /**
+     * Allocate a piece of memory.
+     * @param size: size of memory in bytes
+     * @return void*, the memory, aligned to CLASS_GRANULARITY
+     */
+    void* allocate(const size_t& size);
+
+    /**
+     * Give back a piece of memory allocated by this allocator.
+     * @param p: the memory
+     */
+    void deallocate(void* p);
+
+    /**
+     * Get the owner of the allocator a piece comes from.
+     * @param p: the piece
+     * @return void*, the owner given to the allocator
+     */
+    static inline void* getOwner(const void* p) {
+        return reinterpret_cast<const ChunkHeader*>(reinterpret_cast<uintptr_t>(p) & ~(CHUNK_SIZE - 1))->owner;
+    }
+
+    /**
+     * Get the size class of a piece.
+     * @param p: the piece
+     * @return size_t, index of size class, or CLASSES_NUMBER for a large piece
+     */
+    static inline size_t getClassIndex(const void* p) {
+        return reinterpret_cast<const ChunkHeader*>(reinterpret_cast<uintptr_t>(p) & ~(CHUNK_SIZE - 1))->index;
+    }
+
+    /**
+     * Get the number of pieces in use.
+     * @return size_t, number of pieces
+     */
+    inline size_t getPiecesNumber() const {
+        return _pieces;
+    }
+
+    /**
+     * Get occupancy of a size class.
+     * @param index: index of size class
+     * @return Statistics, occupancy of the class
+     */
+    Statistics getStatistics(const size_t& index) const;
+
+    /**
+     * Get occupancy of all size classes and large pieces.
+     * @return Statistics, occupancy of the allocator
+     */
+    Statistics getStatistics() const;
+
+private:
+    /**
+     * Header at the start of each chunk.
+     */
+    struct ChunkHeader {
+        /**
+         * Index of size class, or CLASSES_NUMBER for a chunk holding a large piece
+         */
+        size_t index;
+
+        /**
+         * Number of pieces in use
+         */
+        size_t used;
+
+        /**
+         * Size of chunk in bytes
+         */
+        size_t size;
+
+        /**
+         * Owner of the allocator
+         */
+        void* owner;
+    };
+
+    /**
+     * Free piece, linked to the next free piece of the same class.
+     */
+    struct FreePiece {
+        FreePiece* next;
+    };
+
+    /**
+     * A size class.
+     */
+    struct SizeClass {
+        /**
+         * Free pieces
+         */
+        FreePiece* free;
+
+        /**
+         * Chunks carved for this class
+         */
+        std::vector<ChunkHeader*> chunks;
+    };
+
+    /**
+     * Offset of the first piece in a chunk, keeping pieces aligned
+     */
+    static constexpr size_t HEADER_SIZE =
+            (sizeof(ChunkHeader) + CLASS_GRANULARITY - 1) / CLASS_GRANULARITY * CLASS_GRANULARITY;
+
+    /**
+     * Size classes
+     */
+    SizeClass _classes[CLASSES_NUMBER];
+
+    /**
+     * Chunks holding large pieces
+     */
+    std::vector<ChunkHeader*> _large;
+
+    /**
+     * Owner of this allocator
+     */
+    void* _owner;
+
+    /**
+     * Number of pieces in use
+     */
+    size_t _pieces;
+
+    /**
+     * Allocate a chunk from system.
+     * @param size: size of chunk, a multiple of CHUNK_SIZE
+     * @param index: index of size class
+     * @return ChunkHeader*, the chunk
+     */
+    ChunkHeader* allocateChunk(const size_t& size, const size_t& index);
+
+    /**
+     * Carve a new chunk into free pieces of a size class.
+     * @param index: index of size class
+     */
+    void grow(const size_t& index);
+
+    /**
+     * Get size of pieces in a size class.
+     * @param index: index of size class
+     * @return size_t, size in bytes
+     */
+    static inline size_t getPieceSize(const size_t& index) {
+        return (index + 1) * CLASS_GRANULARITY;
+    }
+};
+
+} // namespace ngind::memory
+
+#endif //NGIND_SLAB_ALLOCATOR_H
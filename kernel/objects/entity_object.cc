@@ -30,8 +30,10 @@
 
 namespace ngind::objects {
 
-EntityObject::EntityObject() : Object(), _position(), _scale(1, 1),
-_rotation(0.0f), _z_order(0), _anchor(0.5f, 0.5f), _global_rotation(0.0f), _global_scale(), _global_position(), _id(-1) {
+EntityObject::EntityObject() : Object(), _position(), _global_position(), _scale(1, 1), _global_scale(),
+_anchor(0.5f, 0.5f), _rotation(0.0f), _global_rotation(0.0f),
+_previous_position(), _previous_scale(), _previous_rotation(0.0f), _saved(false),
+_render_position(), _render_scale(), _render_rotation(0.0f), _z_order(0), _id(-1) {
 }
 
 EntityObject::~EntityObject() {
@@ -42,6 +44,34 @@ void EntityObject::update(const float& delta) {
     Object::update(delta);
 }
 
+void EntityObject::render(const float& alpha) {
+    glm::vec2 position = _global_position, scale = _global_scale;
+    float rotation = _global_rotation;
+    if (_saved) {
+        position = glm::mix(_previous_position, _global_position, alpha);
+        scale = glm::mix(_previous_scale, _global_scale, alpha);
+        rotation = glm::mix(_previous_rotation, _global_rotation, alpha);
+    }
+
+    if (position != _render_position || scale != _render_scale || rotation != _render_rotation) {
+        _render_position = position;
+        _render_scale = scale;
+        _render_rotation = rotation;
+        setDirtyComponents();
+    }
+
+    Object::render(alpha);
+}
+
+void EntityObject::saveState() {
+    _previous_position = _global_position;
+    _previous_scale = _global_scale;
+    _previous_rotation = _global_rotation;
+    _saved = true;
+
+    Object::saveState();
+}
+
 void EntityObject::adjustGlobalPosition() {
     auto p = dynamic_cast<EntityObject*>(_parent);
     if (p == nullptr) {
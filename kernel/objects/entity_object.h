@@ -55,6 +55,12 @@ public:
     /// @see kernel/objects/object.h
     void update(const float&) override;
 
+    /// @see kernel/objects/object.h
+    void render(const float& alpha) override;
+
+    /// @see kernel/objects/object.h
+    void saveState() override;
+
     /**
      * Set position for this object
      * @param v: new position
@@ -130,6 +136,14 @@ public:
         return _global_position.y;
     }
 
+    /**
+     * Get global position used by rendering, which is interpolated between simulation states.
+     * @return glm::vec2, the position
+     */
+    inline glm::vec2 getRenderPosition() const {
+        return _render_position;
+    }
+
     /**
      * Set scale property of this object
      * @param v: new scale
@@ -205,6 +219,14 @@ public:
         return _global_scale.y;
     }
 
+    /**
+     * Get global scale used by rendering, which is interpolated between simulation states.
+     * @return glm::vec2, the scale
+     */
+    inline glm::vec2 getRenderScale() const {
+        return _render_scale;
+    }
+
     /**
      * Set rotation for this object
      * @param f: new rotation angle
@@ -230,6 +252,14 @@ public:
         return _global_rotation;
     }
 
+    /**
+     * Get global rotation used by rendering, which is interpolated between simulation states.
+     * @return float, the rotation
+     */
+    inline float getRenderRotation() const {
+        return _render_rotation;
+    }
+
     /**
      * Get the order in z dim
      * @return int, z order
@@ -340,6 +370,23 @@ private:
      */
     float _global_rotation;
 
+    /**
+     * Global transform at the start of current simulation step
+     */
+    glm::vec2 _previous_position, _previous_scale;
+    float _previous_rotation;
+
+    /**
+     * True if previous transform has been saved
+     */
+    bool _saved;
+
+    /**
+     * Global transform used by rendering
+     */
+    glm::vec2 _render_position, _render_scale;
+    float _render_rotation;
+
     /**
      * The z order of this object
      */
@@ -26,6 +26,7 @@
 #include "object.h"
 #include "entity_object.h"
 #include "log/logger_factory.h"
+#include "memory/memory_pool.h"
 
 #ifdef ENABLE_PHYSICS
 #include "extern/physics/physics_world.h"
@@ -39,20 +40,23 @@ Object::Object() : AutoCollectionObject(), _parent(nullptr) {
 }
 
 Object::~Object() {
-    for (auto [name, child] : this->_children) {
-        child->removeReference();
-    }
+    // children and components destroyed with the same arena may be gone already.
+    if (!memory::MemoryPool::getInstance()->isTearingDown(this)) {
+        for (auto [name, child] : this->_children) {
+            child->removeReference();
+        }
 
-    for (auto [name, com] : this->_components) {
-        com->removeReference();
+        for (auto [name, com] : this->_components) {
+            com->removeReference();
 #ifdef ENABLE_PHYSICS
-        if (name == "PhysicsWorld") {
-            auto world = dynamic_cast<physics::PhysicsWorld*>(com);
-            if (world != nullptr) {
-                world->clearRigidBody(this);
+            if (name == "PhysicsWorld") {
+                auto world = dynamic_cast<physics::PhysicsWorld*>(com);
+                if (world != nullptr) {
+                    world->clearRigidBody(this);
+                }
             }
-        }
 #endif
+        }
     }
 
     this->_children.clear();
@@ -93,6 +97,39 @@ EntityObject* Object::getChildByName(const std::string& name) {
     return object;
 }
 
+void Object::promote() {
+    AutoCollectionObject::promote();
+    for (auto component : this->_components) {
+        component.second->promote();
+    }
+
+    for (auto child : this->_children) {
+        if (child.second) {
+            child.second->promote();
+        }
+    }
+}
+
+void Object::render(const float& alpha) {
+    for (auto component : this->_components) {
+        component.second->render();
+    }
+
+    for (auto child : this->_children) {
+        if (child.second) {
+            child.second->render(alpha);
+        }
+    }
+}
+
+void Object::saveState() {
+    for (auto child : this->_children) {
+        if (child.second) {
+            child.second->saveState();
+        }
+    }
+}
+
 void Object::update(const float& delta) {
     for (auto component : this->_components) {
         component.second->update(delta);
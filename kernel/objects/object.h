@@ -116,6 +116,22 @@ public:
      */
     void update(const float&) override;
 
+    /**
+     * @see kernel/memory/auto_collection_object.h
+     */
+    void promote() override;
+
+    /**
+     * Send rendering commands of components and children. It's called once per frame after all updates.
+     * @param alpha: progress from previous simulation state to current one, in [0, 1]
+     */
+    virtual void render(const float& alpha);
+
+    /**
+     * Remember current state as previous simulation state. It's called before each fixed step.
+     */
+    virtual void saveState();
+
     /**
      * Add a component. If component exists, nothing will happen.
      * @param name: name of component
@@ -34,10 +34,11 @@
 #include "object_factory.h"
 #include "prefab_factory.h"
 #include "log/logger_factory.h"
+#include "timer/profiler.h"
 
 namespace ngind::objects {
 
-World::World(std::string name) : Object(), _name(std::move(name)), _config(nullptr), _background_color() {
+World::World(std::string name) : Object(), _name(std::move(name)), _config(nullptr), _background_color(), _arena(nullptr) {
     try {
         _config = resources::ResourcesManager::getInstance()->load<resources::ConfigResource>("worlds/" + _name + ".json");
         _background_color = rendering::Color((*_config)["background-color"].GetString());
@@ -56,7 +57,8 @@ World::World(std::string name) : Object(), _name(std::move(name)), _config(nullp
     }
 }
 
-World::World(resources::ConfigResource* config) : Object(), _name(), _config(config), _background_color() {
+World::World(resources::ConfigResource* config) : Object(), _name(), _config(config), _background_color(),
+    _arena(nullptr) {
     try {
         _name = (*_config)["world-name"].GetString();
         _background_color = rendering::Color((*_config)["background-color"].GetString());
@@ -78,13 +80,23 @@ World::World(resources::ConfigResource* config) : Object(), _name(), _config(con
 World::~World() {
     resources::ResourcesManager::getInstance()->release(_config);
     PrefabFactory::getInstance()->clearCache();
+
+    // loaded objects are destroyed in bulk, so references held by this world are ignored.
+    memory::MemoryPool::getInstance()->destroyArena(_arena);
+    _arena = nullptr;
 }
 
 void World::update(const float& delta) {
+    NGIND_PROFILE_ZONE("World::update");
     Object::update(delta);
 }
 
 void World::loadObjects() {
+    if (_arena == nullptr) {
+        _arena = memory::MemoryPool::getInstance()->createArena();
+    }
+
+    memory::MemoryPool::ArenaScope scope{_arena};
     try {
         auto children = (*_config)["children"].GetArray();
 
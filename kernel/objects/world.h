@@ -34,6 +34,7 @@
 #include "resources/config_resource.h"
 #include "rendering/color.h"
 #include "script/lua_registration.h"
+#include "memory/memory_pool.h"
 
 namespace ngind::objects {
 
@@ -148,6 +149,11 @@ private:
      * Table containing all entity objects in the world
      */
     std::unordered_map<int, EntityObject*> _all_children;
+
+    /**
+     * Arena holding objects loaded by this world. They are destroyed together with the world
+     */
+    memory::MemoryPool::Arena* _arena;
 };
 
 NGIND_LUA_BRIDGE_REGISTRATION(World) {
@@ -96,6 +96,11 @@ public:
     }
 
     glm::vec2 screenToWorldSpace(const glm::vec2& pos);
+
+    /**
+     * Update OpenGL context. It applies the viewport again, e.g. after drawing into offscreen buffers.
+     */
+    void update();
 private:
     /**
      * The unique instance.
@@ -119,11 +124,6 @@ private:
 
     Adaptor() : _tactic(ResolutionAdaptionTactic::EXACT_FIT), _screen(), _resolution() {}
     ~Adaptor() = default;
-
-    /**
-     * Update OpenGL context.
-     */
-    void update();
 };
 
 } // namespace ngind::rendering
@@ -0,0 +1,291 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file block_compression.cc
+
+
+#include "block_compression.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ngind::rendering {
+
+namespace {
+/**
+ * Pack a color into RGB565.
+ */
+uint16_t packColor(const int& r, const int& g, const int& b) {
+    return static_cast<uint16_t>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+}
+
+/**
+ * Unpack a RGB565 color.
+ */
+void unpackColor(const uint16_t& c, int* color) {
+    int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+void writeInteger(std::string& content, const uint32_t& value) {
+    for (int i = 0; i < 4; i++) {
+        content += static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+}
+
+uint32_t readInteger(const std::string& content, const size_t& pos) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(content[pos + i])) << (i * 8);
+    }
+
+    return value;
+}
+} // namespace
+
+size_t BlockCompression::getSize(const int& width, const int& height, const Format& format) {
+    size_t blocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+    return blocks * ((format == FORMAT_DXT1) ? 8 : 16);
+}
+
+std::string BlockCompression::encode(const unsigned char* pixels, const int& width, const int& height, const Format& format) {
+    std::string content = MAGIC;
+    writeInteger(content, VERSION);
+    writeInteger(content, format);
+    writeInteger(content, width);
+    writeInteger(content, height);
+    writeInteger(content, getSize(width, height, format));
+
+    unsigned char block[64], output[16];
+    for (int by = 0; by < height; by += 4) {
+        for (int bx = 0; bx < width; bx += 4) {
+            // pixels out of image repeat the border
+            for (int y = 0; y < 4; y++) {
+                for (int x = 0; x < 4; x++) {
+                    int sx = std::min(bx + x, width - 1), sy = std::min(by + y, height - 1);
+                    std::memcpy(&block[(y * 4 + x) * 4], &pixels[(sy * width + sx) * 4], 4);
+                }
+            }
+
+            if (format == FORMAT_DXT5) {
+                encodeAlpha(block, output);
+                encodeColor(block, output + 8);
+                content.append(reinterpret_cast<char*>(output), 16);
+            }
+            else {
+                encodeColor(block, output);
+                content.append(reinterpret_cast<char*>(output), 8);
+            }
+        }
+    }
+
+    return content;
+}
+
+bool BlockCompression::readHeader(const std::string& content, Header& header) {
+    if (content.size() < HEADER_SIZE || content.compare(0, 4, MAGIC) != 0 || readInteger(content, 4) != VERSION) {
+        return false;
+    }
+
+    auto format = readInteger(content, 8);
+    if (format != FORMAT_DXT1 && format != FORMAT_DXT5) {
+        return false;
+    }
+
+    header.format = static_cast<Format>(format);
+    header.width = static_cast<int>(readInteger(content, 12));
+    header.height = static_cast<int>(readInteger(content, 16));
+    header.size = readInteger(content, 20);
+
+    return header.size == getSize(header.width, header.height, header.format) &&
+           content.size() >= HEADER_SIZE + header.size;
+}
+
+void BlockCompression::decode(const unsigned char* blocks, const Header& header, unsigned char* pixels, const int& channels) {
+    unsigned char block[64];
+    for (int by = 0; by < header.height; by += 4) {
+        for (int bx = 0; bx < header.width; bx += 4) {
+            if (header.format == FORMAT_DXT5) {
+                decodeColor(blocks + 8, block, true);
+                decodeAlpha(blocks, block);
+                blocks += 16;
+            }
+            else {
+                decodeColor(blocks, block, false);
+                blocks += 8;
+            }
+
+            for (int y = 0; y < 4 && by + y < header.height; y++) {
+                for (int x = 0; x < 4 && bx + x < header.width; x++) {
+                    std::memcpy(&pixels[((by + y) * header.width + bx + x) * channels], &block[(y * 4 + x) * 4], channels);
+                }
+            }
+        }
+    }
+}
+
+void BlockCompression::encodeColor(const unsigned char* block, unsigned char* output) {
+    int min[3] = {255, 255, 255}, max[3] = {0, 0, 0};
+    for (int i = 0; i < 16; i++) {
+        for (int c = 0; c < 3; c++) {
+            min[c] = std::min(min[c], static_cast<int>(block[i * 4 + c]));
+            max[c] = std::max(max[c], static_cast<int>(block[i * 4 + c]));
+        }
+    }
+
+    // move end points inwards a little to reduce error of the bounding box fit
+    for (int c = 0; c < 3; c++) {
+        int inset = (max[c] - min[c]) >> 4;
+        min[c] += inset; max[c] -= inset;
+    }
+
+    uint16_t c0 = packColor(max[0], max[1], max[2]), c1 = packColor(min[0], min[1], min[2]);
+    uint32_t indices = 0;
+    if (c0 < c1) {
+        std::swap(c0, c1);
+    }
+
+    if (c0 != c1) {
+        int palette[4][3];
+        unpackColor(c0, palette[0]); unpackColor(c1, palette[1]);
+        for (int c = 0; c < 3; c++) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+
+        for (int i = 0; i < 16; i++) {
+            int best = 0, best_distance = 0x7FFFFFFF;
+            for (int j = 0; j < 4; j++) {
+                int distance = 0;
+                for (int c = 0; c < 3; c++) {
+                    int d = block[i * 4 + c] - palette[j][c];
+                    distance += d * d;
+                }
+
+                if (distance < best_distance) {
+                    best = j; best_distance = distance;
+                }
+            }
+
+            indices |= static_cast<uint32_t>(best) << (i * 2);
+        }
+    }
+
+    output[0] = c0 & 0xFF; output[1] = c0 >> 8;
+    output[2] = c1 & 0xFF; output[3] = c1 >> 8;
+    for (int i = 0; i < 4; i++) {
+        output[4 + i] = (indices >> (i * 8)) & 0xFF;
+    }
+}
+
+void BlockCompression::encodeAlpha(const unsigned char* block, unsigned char* output) {
+    int a0 = 0, a1 = 255;
+    for (int i = 0; i < 16; i++) {
+        a0 = std::max(a0, static_cast<int>(block[i * 4 + 3]));
+        a1 = std::min(a1, static_cast<int>(block[i * 4 + 3]));
+    }
+
+    uint64_t indices = 0;
+    if (a0 != a1) {
+        int palette[8] = {a0, a1};
+        for (int j = 1; j < 7; j++) {
+            palette[j + 1] = ((7 - j) * a0 + j * a1) / 7;
+        }
+
+        for (int i = 0; i < 16; i++) {
+            int best = 0, best_distance = 256;
+            for (int j = 0; j < 8; j++) {
+                int distance = std::abs(block[i * 4 + 3] - palette[j]);
+                if (distance < best_distance) {
+                    best = j; best_distance = distance;
+                }
+            }
+
+            indices |= static_cast<uint64_t>(best) << (i * 3);
+        }
+    }
+
+    output[0] = a0; output[1] = a1;
+    for (int i = 0; i < 6; i++) {
+        output[2 + i] = (indices >> (i * 8)) & 0xFF;
+    }
+}
+
+void BlockCompression::decodeColor(const unsigned char* input, unsigned char* block, const bool& opaque_only) {
+    uint16_t c0 = input[0] | (input[1] << 8), c1 = input[2] | (input[3] << 8);
+    int palette[4][4];
+    unpackColor(c0, palette[0]); unpackColor(c1, palette[1]);
+    palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+
+    for (int c = 0; c < 3; c++) {
+        if (c0 > c1 || opaque_only) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        else {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+
+    if (c0 <= c1 && !opaque_only) {
+        palette[3][3] = 0;
+    }
+
+    uint32_t indices = input[4] | (input[5] << 8) | (input[6] << 16) | (static_cast<uint32_t>(input[7]) << 24);
+    for (int i = 0; i < 16; i++) {
+        auto& color = palette[(indices >> (i * 2)) & 3];
+        for (int c = 0; c < 4; c++) {
+            block[i * 4 + c] = static_cast<unsigned char>(color[c]);
+        }
+    }
+}
+
+void BlockCompression::decodeAlpha(const unsigned char* input, unsigned char* block) {
+    int a0 = input[0], a1 = input[1];
+    int palette[8] = {a0, a1};
+    if (a0 > a1) {
+        for (int j = 1; j < 7; j++) {
+            palette[j + 1] = ((7 - j) * a0 + j * a1) / 7;
+        }
+    }
+    else {
+        for (int j = 1; j < 5; j++) {
+            palette[j + 1] = ((5 - j) * a0 + j * a1) / 5;
+        }
+        palette[6] = 0; palette[7] = 255;
+    }
+
+    uint64_t indices = 0;
+    for (int i = 0; i < 6; i++) {
+        indices |= static_cast<uint64_t>(input[2 + i]) << (i * 8);
+    }
+
+    for (int i = 0; i < 16; i++) {
+        block[i * 4 + 3] = static_cast<unsigned char>(palette[(indices >> (i * 3)) & 7]);
+    }
+}
+
+} // namespace ngind::rendering
@@ -0,0 +1,151 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file block_compression.h
+
+
+#ifndef NGIND_BLOCK_COMPRESSION_H
+#define NGIND_BLOCK_COMPRESSION_H
+
+#include <string>
+#include <cstdint>
+
+namespace ngind::rendering {
+
+/**
+ * S3TC block compression and the container storing compressed textures. Each 4x4
+ * block of pixels is stored in 8 bytes (DXT1, opaque) or 16 bytes (DXT5, with alpha),
+ * so that GPU can sample compressed textures directly.
+ * The container is a 24 bytes header followed by blocks in row order:
+ * magic "NGTC", version, format, width, height, size of blocks, as 32 bits little endian integers.
+ */
+class BlockCompression {
+public:
+    /**
+     * Block formats.
+     */
+    enum Format {
+        FORMAT_DXT1 = 0,
+        FORMAT_DXT5 = 1
+    };
+
+    /**
+     * Extension of compressed texture files
+     */
+    constexpr static char EXTENSION[] = "ngtc";
+
+    /**
+     * Magic number of container
+     */
+    constexpr static char MAGIC[] = "NGTC";
+
+    /**
+     * Version of container
+     */
+    constexpr static uint32_t VERSION = 1;
+
+    /**
+     * Size of container header in bytes
+     */
+    constexpr static size_t HEADER_SIZE = 24;
+
+    /**
+     * Header of container.
+     */
+    struct Header {
+        Format format;
+        int width;
+        int height;
+        size_t size;
+    };
+
+    /**
+     * Get the size of blocks.
+     * @param width: width of image
+     * @param height: height of image
+     * @param format: block format
+     * @return size_t, size in bytes
+     */
+    static size_t getSize(const int& width, const int& height, const Format& format);
+
+    /**
+     * Compress pixels into a container.
+     * @param pixels: pixels in RGBA
+     * @param width: width of image
+     * @param height: height of image
+     * @param format: block format. Alpha is dropped if it's DXT1
+     * @return std::string, the container
+     */
+    static std::string encode(const unsigned char* pixels, const int& width, const int& height, const Format& format);
+
+    /**
+     * Read the header of container.
+     * @param content: the container
+     * @param header: the header read
+     * @return bool, true if it's a valid container
+     */
+    static bool readHeader(const std::string& content, Header& header);
+
+    /**
+     * Decompress blocks into pixels, used if GPU doesn't support S3TC.
+     * @param blocks: blocks data
+     * @param header: header of container
+     * @param pixels: output pixels, whose size should be width * height * channels
+     * @param channels: 3 for RGB, 4 for RGBA
+     */
+    static void decode(const unsigned char* blocks, const Header& header, unsigned char* pixels, const int& channels);
+
+private:
+    /**
+     * Compress color of a block.
+     * @param block: 16 pixels in RGBA
+     * @param output: 8 bytes color block
+     */
+    static void encodeColor(const unsigned char* block, unsigned char* output);
+
+    /**
+     * Compress alpha of a block.
+     * @param block: 16 pixels in RGBA
+     * @param output: 8 bytes alpha block
+     */
+    static void encodeAlpha(const unsigned char* block, unsigned char* output);
+
+    /**
+     * Decompress color of a block.
+     * @param input: 8 bytes color block
+     * @param block: 16 pixels in RGBA
+     * @param opaque_only: true if the block is always in four colors mode
+     */
+    static void decodeColor(const unsigned char* input, unsigned char* block, const bool& opaque_only);
+
+    /**
+     * Decompress alpha of a block.
+     * @param input: 8 bytes alpha block
+     * @param block: 16 pixels in RGBA
+     */
+    static void decodeAlpha(const unsigned char* input, unsigned char* block);
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_BLOCK_COMPRESSION_H
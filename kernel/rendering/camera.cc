@@ -27,8 +27,8 @@
 
 #include <iostream>
 
-#include "SOIL2/SOIL2.h"
 #include "adaptor.h"
+#include "screen_capture.h"
 #include "log/logger_factory.h"
 
 namespace ngind::rendering {
@@ -68,25 +68,15 @@ void Camera::init(const glm::vec2& center, const size_t& width, const size_t& he
 }
 
 void Camera::capture(const std::string& filename) const {
-    glReadBuffer(GL_FRONT);
-
-    glPixelStorei(GL_PACK_ALIGNMENT,1);
-    auto buffer = new unsigned char[_width * _height * sizeof(unsigned char) * 4];
-    glReadPixels(0, 0, _width, _height, GL_RGBA, GL_UNSIGNED_BYTE, buffer);
-
-    for (int i = 0; i < _width; i++) {
-        for (int j = 0; j < _height / 2; j++) {
-            std::swap(buffer[(j * _width + i) * 4], buffer[((_height - j - 1) * _width + i) * 4]);
-            std::swap(buffer[(j * _width + i) * 4 + 1], buffer[((_height - j - 1) * _width + i) * 4 + 1]);
-            std::swap(buffer[(j * _width + i) * 4 + 2], buffer[((_height - j - 1) * _width + i) * 4 + 2]);
-            std::swap(buffer[(j * _width + i) * 4 + 3], buffer[((_height - j - 1) * _width + i) * 4 + 3]);
-        }
-    }
+    ScreenCapture::getInstance()->capture(filename, _width, _height);
+}
 
-    SOIL_save_image(filename.c_str(), SOIL_SAVE_TYPE_PNG, _width, _height, SOIL_LOAD_RGBA, buffer);
+void Camera::startBurstCapture(const std::string& prefix, const size_t& frames) const {
+    ScreenCapture::getInstance()->startBurst(prefix, frames, _width, _height);
+}
 
-    delete[] buffer;
-    buffer = nullptr;
+void Camera::stopBurstCapture() const {
+    ScreenCapture::getInstance()->stopBurst();
 }
 
 } // namespace ngind::rendering
\ No newline at end of file
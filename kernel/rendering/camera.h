@@ -84,11 +84,24 @@ public:
     }
 
     /**
-     * Capture a picture in the screen.
+     * Capture a picture in the screen. The picture is read back when current frame
+     * is drawn and saved asynchronously.
      * @param filename: the saved file's name
      */
     void capture(const std::string& filename) const;
 
+    /**
+     * Capture following frames, saved as prefix_00000.png, prefix_00001.png...
+     * @param prefix: prefix of saved files' names
+     * @param frames: number of frames
+     */
+    void startBurstCapture(const std::string& prefix, const size_t& frames) const;
+
+    /**
+     * Stop capturing following frames.
+     */
+    void stopBurstCapture() const;
+
     /**
      * Get camera's position
      * @return glm::vec2, camera's position
@@ -128,6 +141,8 @@ NGIND_LUA_BRIDGE_REGISTRATION(Camera) {
                 .addStaticFunction("getInstance", &Camera::getInstance)
                 .addFunction("moveTo", &Camera::moveTo)
                 .addFunction("capture", &Camera::capture)
+                .addFunction("startBurstCapture", &Camera::startBurstCapture)
+                .addFunction("stopBurstCapture", &Camera::stopBurstCapture)
                 .addFunction("getCameraPosition", &Camera::getCameraPosition)
             .endClass()
         .endNamespace();
@@ -33,10 +33,15 @@ namespace ngind::rendering {
  */
 struct Character {
     /**
-     * Texture id
+     * Texture id of the atlas page holding the bitmap, 0 if bitmap is empty
      */
     GLuint texture;
 
+    /**
+     * Texture coordinates of bitmap in the atlas page (left, top, right, bottom)
+     */
+    glm::vec4 uv;
+
     /**
      * Size of bitmap
      */
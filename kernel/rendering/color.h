@@ -47,6 +47,14 @@ struct Color {
      * R,G,B,A components.
      */
     unsigned char r, g, b, a;
+
+    inline bool operator== (const Color& other) const {
+        return r == other.r && g == other.g && b == other.b && a == other.a;
+    }
+
+    inline bool operator!= (const Color& other) const {
+        return !(*this == other);
+    }
 private:
     static unsigned int convertHexString(const std::string& str) {
         unsigned int res = 0;
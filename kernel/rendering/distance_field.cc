@@ -0,0 +1,108 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file distance_field.cc
+
+#include "distance_field.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ngind::rendering {
+
+std::vector<unsigned char> DistanceField::generate(const unsigned char* bitmap, const int& width, const int& height, const int& spread) {
+    auto padded_width = width + spread * 2, padded_height = height + spread * 2;
+    std::vector<float> outside(padded_width * padded_height, INF), inside(padded_width * padded_height, 0.0f);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (bitmap[y * width + x] >= 128) {
+                auto index = (y + spread) * padded_width + x + spread;
+                outside[index] = 0.0f;
+                inside[index] = INF;
+            }
+        }
+    }
+
+    transform(outside, padded_width, padded_height);
+    transform(inside, padded_width, padded_height);
+
+    std::vector<unsigned char> field(padded_width * padded_height);
+    for (size_t i = 0; i < field.size(); i++) {
+        // pixel centers are half a pixel away from the edge
+        auto distance = (inside[i] == 0.0f) ? std::sqrt(outside[i]) - 0.5f : 0.5f - std::sqrt(inside[i]);
+        auto value = 0.5f - distance / (spread * 2.0f);
+        field[i] = static_cast<unsigned char>(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+    }
+
+    return field;
+}
+
+void DistanceField::transform(std::vector<float>& grid, const int& width, const int& height) {
+    auto n = std::max(width, height);
+    std::vector<float> f(n), d(n), z(n + 1);
+    std::vector<int> v(n);
+
+    for (int x = 0; x < width; x++) {
+        for (int y = 0; y < height; y++) {
+            f[y] = grid[y * width + x];
+        }
+
+        transform(f.data(), d.data(), height, v.data(), z.data());
+        for (int y = 0; y < height; y++) {
+            grid[y * width + x] = d[y];
+        }
+    }
+
+    for (int y = 0; y < height; y++) {
+        transform(&grid[y * width], d.data(), width, v.data(), z.data());
+        std::copy(d.begin(), d.begin() + width, grid.begin() + y * width);
+    }
+}
+
+void DistanceField::transform(const float* f, float* d, const int& n, int* v, float* z) {
+    int k = 0;
+    v[0] = 0; z[0] = -INF; z[1] = INF;
+
+    for (int q = 1; q < n; q++) {
+        float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * (q - v[k]));
+        while (s <= z[k]) {
+            k--;
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * (q - v[k]));
+        }
+
+        k++;
+        v[k] = q; z[k] = s; z[k + 1] = INF;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k + 1] < q) {
+            k++;
+        }
+
+        d[q] = static_cast<float>((q - v[k]) * (q - v[k])) + f[v[k]];
+    }
+}
+
+} // namespace ngind::rendering
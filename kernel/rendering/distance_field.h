@@ -0,0 +1,79 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file distance_field.h
+
+#ifndef NGIND_DISTANCE_FIELD_H
+#define NGIND_DISTANCE_FIELD_H
+
+#include <vector>
+
+namespace ngind::rendering {
+
+/**
+ * Signed distance field generator for glyph bitmaps.
+ */
+class DistanceField {
+public:
+    DistanceField() = delete;
+
+    /**
+     * Generate a signed distance field from an 8-bit coverage bitmap. The result is
+     * padded by spread pixels on each side. Edge is encoded as 128, values above it are
+     * inside the glyph, and distances beyond spread pixels are clamped.
+     * @param bitmap: coverage bitmap
+     * @param width: width of bitmap
+     * @param height: height of bitmap
+     * @param spread: max distance in pixels the field covers
+     * @return std::vector<unsigned char>, the distance field whose size is (width + 2 * spread) x (height + 2 * spread)
+     */
+    static std::vector<unsigned char> generate(const unsigned char* bitmap, const int& width, const int& height, const int& spread);
+
+private:
+    /**
+     * A large value standing for no feature pixel
+     */
+    constexpr static float INF = 1e20f;
+
+    /**
+     * Squared euclidean distance transform of a grid, in place.
+     * @param grid: 0 for feature pixels and INF for others
+     * @param width: width of grid
+     * @param height: height of grid
+     */
+    static void transform(std::vector<float>& grid, const int& width, const int& height);
+
+    /**
+     * One dimension squared distance transform of a sampled function.
+     * @param f: the sampled function
+     * @param d: the result
+     * @param n: number of samples
+     * @param v: buffer for parabola locations, n elements at least
+     * @param z: buffer for parabola boundaries, n + 1 elements at least
+     */
+    static void transform(const float* f, float* d, const int& n, int* v, float* z);
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_DISTANCE_FIELD_H
@@ -0,0 +1,119 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file glyph_atlas.cc
+
+#include "glyph_atlas.h"
+
+#include "log/logger_factory.h"
+
+namespace ngind::rendering {
+
+GlyphAtlas::GlyphAtlas() : _pages() {
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    for (const auto& page : _pages) {
+        glDeleteTextures(1, &page.texture);
+    }
+
+    _pages.clear();
+}
+
+bool GlyphAtlas::insert(const glm::ivec2& size, const unsigned char* data, Character& character) {
+    auto width = size.x + PADDING, height = size.y + PADDING;
+    if (width > PAGE_SIZE || height > PAGE_SIZE) {
+        auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+        logger->log("Glyph is too large for atlas.");
+        logger->flush();
+        return false;
+    }
+
+    glm::ivec2 position{};
+    Page* target = nullptr;
+    for (auto& page : _pages) {
+        if (allocate(page, width, height, position)) {
+            target = &page;
+            break;
+        }
+    }
+
+    if (target == nullptr) {
+        createPage();
+        target = &_pages.back();
+        allocate(*target, width, height, position);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, target->texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, position.x, position.y, size.x, size.y, GL_RED, GL_UNSIGNED_BYTE, data);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    constexpr float SCALE = 1.0f / PAGE_SIZE;
+    character.texture = target->texture;
+    character.uv = {position.x * SCALE, position.y * SCALE,
+                    (position.x + size.x) * SCALE, (position.y + size.y) * SCALE};
+    return true;
+}
+
+bool GlyphAtlas::allocate(Page& page, const GLsizei& width, const GLsizei& height, glm::ivec2& position) {
+    Shelf* best = nullptr;
+    for (auto& shelf : page.shelves) {
+        if (shelf.height >= height && shelf.width + width <= PAGE_SIZE &&
+            (best == nullptr || shelf.height < best->height)) {
+            best = &shelf;
+        }
+    }
+
+    if (best == nullptr) {
+        if (page.bottom + height > PAGE_SIZE) {
+            return false;
+        }
+
+        page.shelves.push_back(Shelf{page.bottom, height, 0});
+        page.bottom += height;
+        best = &page.shelves.back();
+    }
+
+    position = {best->width, best->y};
+    best->width += width;
+    return true;
+}
+
+void GlyphAtlas::createPage() {
+    Page page{0, {}, 0};
+    std::vector<unsigned char> empty(PAGE_SIZE * PAGE_SIZE, 0);
+
+    glGenTextures(1, &page.texture);
+    glBindTexture(GL_TEXTURE_2D, page.texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, PAGE_SIZE, PAGE_SIZE, 0, GL_RED, GL_UNSIGNED_BYTE, empty.data());
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    _pages.push_back(page);
+}
+
+} // namespace ngind::rendering
@@ -0,0 +1,140 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file glyph_atlas.h
+
+#ifndef NGIND_GLYPH_ATLAS_H
+#define NGIND_GLYPH_ATLAS_H
+
+#include "GL/glew.h"
+
+#include <vector>
+
+#include "character.h"
+#include "glm/glm.hpp"
+
+namespace ngind::rendering {
+
+/**
+ * Texture atlas for glyph bitmaps. Bitmaps are packed into single channel pages
+ * shelf by shelf, so that glyphs of one font share a few textures.
+ */
+class GlyphAtlas {
+public:
+    /**
+     * Width and height of each page.
+     */
+    constexpr static GLsizei PAGE_SIZE = 1024;
+
+    /**
+     * Empty pixels between two glyphs, avoiding bleeding when sampling.
+     */
+    constexpr static GLsizei PADDING = 1;
+
+    GlyphAtlas();
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator= (const GlyphAtlas&) = delete;
+
+    /**
+     * Pack a bitmap into the atlas. A new page is created if no page has enough space.
+     * @param size: size of bitmap
+     * @param data: 8-bit bitmap data
+     * @param character: the character whose texture and uv rectangle will be set
+     * @return bool, true if bitmap is packed
+     */
+    bool insert(const glm::ivec2& size, const unsigned char* data, Character& character);
+
+    /**
+     * Get the number of pages.
+     * @return size_t, the number of pages
+     */
+    inline size_t getPagesNumber() const {
+        return _pages.size();
+    }
+private:
+    /**
+     * A row of glyphs in a page.
+     */
+    struct Shelf {
+        /**
+         * Top of shelf
+         */
+        GLsizei y;
+
+        /**
+         * Height of shelf
+         */
+        GLsizei height;
+
+        /**
+         * Used width of shelf
+         */
+        GLsizei width;
+    };
+
+    /**
+     * A texture page in the atlas.
+     */
+    struct Page {
+        /**
+         * Texture id
+         */
+        GLuint texture;
+
+        /**
+         * Shelves in this page
+         */
+        std::vector<Shelf> shelves;
+
+        /**
+         * Bottom of the last shelf
+         */
+        GLsizei bottom;
+    };
+
+    /**
+     * All pages
+     */
+    std::vector<Page> _pages;
+
+    /**
+     * Find space for a rectangle in the page.
+     * @param page: the page
+     * @param width: width of rectangle
+     * @param height: height of rectangle
+     * @param position: the position of rectangle if space is found
+     * @return bool, true if space is found
+     */
+    static bool allocate(Page& page, const GLsizei& width, const GLsizei& height, glm::ivec2& position);
+
+    /**
+     * Create a new empty page.
+     */
+    void createPage();
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_GLYPH_ATLAS_H
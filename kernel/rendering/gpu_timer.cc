@@ -0,0 +1,105 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file gpu_timer.cc
+
+
+#include "gpu_timer.h"
+
+namespace ngind::rendering {
+
+GpuTimer::GpuTimer() : _current(0), _active(false) {
+}
+
+GpuTimer::~GpuTimer() {
+    end();
+    for (auto& queries : _queries) {
+        if (!queries.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+        }
+
+        queries.clear();
+    }
+}
+
+void GpuTimer::begin(const char* name, const char* group) {
+    end();
+
+    auto& sections = _sections[_current];
+    auto& queries = _queries[_current];
+    if (sections.size() == queries.size()) {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        queries.push_back(query);
+    }
+
+    auto query = queries[sections.size()];
+    sections.push_back({name, group, query});
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    _active = true;
+}
+
+void GpuTimer::end() {
+    if (_active) {
+        glEndQuery(GL_TIME_ELAPSED);
+        _active = false;
+    }
+}
+
+void GpuTimer::nextFrame() {
+    end();
+    _current = (_current + 1) % FRAMES_NUMBER;
+
+    collect(_current);
+    _sections[_current].clear();
+}
+
+bool GpuTimer::collect(const size_t& index) {
+    const auto& sections = _sections[index];
+    if (sections.empty()) {
+        return false;
+    }
+
+    // queries finish in order, so all queries are available if the last one is.
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(sections.back().query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE) {
+        return false;
+    }
+
+    _results.clear();
+    for (const auto& section : sections) {
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(section.query, GL_QUERY_RESULT, &elapsed);
+
+        auto ms = static_cast<float>(static_cast<double>(elapsed) / 1e6);
+        _results[section.name] += ms;
+        if (section.group != nullptr) {
+            _results[section.group] += ms;
+        }
+    }
+
+    return true;
+}
+
+} // namespace ngind::rendering
@@ -0,0 +1,139 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file gpu_timer.h
+
+
+#ifndef NGIND_GPU_TIMER_H
+#define NGIND_GPU_TIMER_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace ngind::rendering {
+
+/**
+ * Measure GPU time of rendering sections by timer queries. Queries of a frame are read
+ * FRAMES_NUMBER - 1 frames later and only if they are available, so reading results never
+ * stalls the pipeline. Sections can't be nested.
+ */
+class GpuTimer {
+public:
+    /**
+     * Number of frames owning query objects, including current frame
+     */
+    static constexpr size_t FRAMES_NUMBER = 3;
+
+    GpuTimer();
+
+    ~GpuTimer();
+
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator= (const GpuTimer&) = delete;
+
+    /**
+     * Start timing a section.
+     * @param name: name of section, which must live as long as the timer
+     * @param group: name of another section which this section's time is added to, or nullptr
+     */
+    void begin(const char* name, const char* group = nullptr);
+
+    /**
+     * Stop timing current section. Nothing happens if no section is being timed.
+     */
+    void end();
+
+    /**
+     * Finish current frame. Results of the frame issued FRAMES_NUMBER - 1 frames ago are
+     * read if GPU has finished it.
+     */
+    void nextFrame();
+
+    /**
+     * Get GPU time of each section in milliseconds. Sections with same name are summed.
+     * @return const std::map<std::string, float>&, the latest results
+     */
+    inline const std::map<std::string, float>& getResults() const {
+        return _results;
+    }
+
+private:
+    /**
+     * A section timed in a frame.
+     */
+    struct Section {
+        /**
+         * Name of section
+         */
+        const char* name;
+
+        /**
+         * Name of group, or nullptr
+         */
+        const char* group;
+
+        /**
+         * Timer query object
+         */
+        GLuint query;
+    };
+
+    /**
+     * Query objects owned by each frame
+     */
+    std::vector<GLuint> _queries[FRAMES_NUMBER];
+
+    /**
+     * Sections timed in each frame
+     */
+    std::vector<Section> _sections[FRAMES_NUMBER];
+
+    /**
+     * Index of current frame in the ring
+     */
+    size_t _current;
+
+    /**
+     * True if a section is being timed
+     */
+    bool _active;
+
+    /**
+     * Latest results in milliseconds
+     */
+    std::map<std::string, float> _results;
+
+    /**
+     * Read results of a frame if they are available.
+     * @param index: index of frame in the ring
+     * @return bool, true if results are read
+     */
+    bool collect(const size_t& index);
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_GPU_TIMER_H
@@ -0,0 +1,58 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file instanced_quad_rendering_command.cc
+
+#include "instanced_quad_rendering_command.h"
+
+#include "renderer.h"
+#include "glm/gtc/matrix_transform.hpp"
+
+namespace ngind::rendering {
+
+InstancedQuadRenderingCommand::InstancedQuadRenderingCommand(const GLuint& tid) : RenderingCommand(),
+_size(), _uv() {
+    this->setTexture(tid);
+}
+
+void InstancedQuadRenderingCommand::prepare() {
+    RenderingCommand::prepare();
+    Renderer::getInstance()->bindTexture(this->getTexture());
+}
+
+void InstancedQuadRenderingCommand::call() {
+    auto instancer = Renderer::getInstance()->getQuadInstancer();
+    instancer->push(getInstanceMatrix(), _uv, this->getColor());
+    instancer->flush();
+}
+
+bool InstancedQuadRenderingCommand::getBounds(glm::vec4& bounds) const {
+    bounds = transformBounds({0.0f, 0.0f, _size.x, _size.y});
+    return true;
+}
+
+glm::mat4 InstancedQuadRenderingCommand::getInstanceMatrix() const {
+    return glm::scale(this->getModel(), glm::vec3{_size, 1.0f});
+}
+
+} // namespace ngind::rendering
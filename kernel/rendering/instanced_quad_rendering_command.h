@@ -0,0 +1,114 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file instanced_quad_rendering_command.h
+
+#ifndef NGIND_INSTANCED_QUAD_RENDERING_COMMAND_H
+#define NGIND_INSTANCED_QUAD_RENDERING_COMMAND_H
+
+#include "rendering_command.h"
+
+namespace ngind::rendering {
+
+/**
+ * Rendering command drawing the shared unit quad as an instance. It holds no vertices
+ * data, so it can be updated in place when the size or texture rectangle changes.
+ */
+class InstancedQuadRenderingCommand : public RenderingCommand {
+public:
+    /**
+     * @param tid: texture id
+     */
+    explicit InstancedQuadRenderingCommand(const GLuint& tid);
+    ~InstancedQuadRenderingCommand() override = default;
+    InstancedQuadRenderingCommand(const InstancedQuadRenderingCommand&) = delete;
+    InstancedQuadRenderingCommand& operator= (const InstancedQuadRenderingCommand&) = delete;
+
+    /**
+     * @see kernel/rendering/rendering_command.h
+     */
+    void call() override;
+
+    /**
+     * @see kernel/rendering/rendering_command.h
+     */
+    void prepare() override;
+
+    /**
+     * @see kernel/rendering/rendering_command.h
+     */
+    bool getBounds(glm::vec4& bounds) const override;
+
+    /**
+     * Set size of quad in local space.
+     * @param size: the size
+     */
+    inline void setSize(const glm::vec2& size) {
+        _size = size;
+    }
+
+    /**
+     * Get size of quad in local space.
+     * @return glm::vec2, the size
+     */
+    inline glm::vec2 getSize() const {
+        return _size;
+    }
+
+    /**
+     * Set texture coordinates of corners.
+     * @param uv: coordinates of left bottom (x, y) and right top (z, w) corners
+     */
+    inline void setUV(const glm::vec4& uv) {
+        _uv = uv;
+    }
+
+    /**
+     * Get texture coordinates of corners.
+     * @return glm::vec4, coordinates of left bottom (x, y) and right top (z, w) corners
+     */
+    inline glm::vec4 getUV() const {
+        return _uv;
+    }
+
+    /**
+     * Get the matrix mapping unit quad to world space.
+     * @return glm::mat4, the matrix
+     */
+    glm::mat4 getInstanceMatrix() const;
+
+private:
+    /**
+     * Size of quad
+     */
+    glm::vec2 _size;
+
+    /**
+     * Texture coordinates of corners
+     */
+    glm::vec4 _uv;
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_INSTANCED_QUAD_RENDERING_COMMAND_H
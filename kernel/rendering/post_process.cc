@@ -0,0 +1,141 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file post_process.cc
+
+
+#include "post_process.h"
+
+#include <algorithm>
+
+#include "renderer.h"
+#include "adaptor.h"
+#include "resources/resources_manager.h"
+#include "log/logger_factory.h"
+
+namespace ngind::rendering {
+
+PostProcess::PostProcess(const std::string& name) : _config(nullptr), _passes(), _scene(nullptr), _vao(0) {
+    auto manager = resources::ResourcesManager::getInstance();
+    _config = manager->load<resources::ConfigResource>(std::string{POST_PROCESS_CONFIG_PATH} + name + ".json");
+
+    try {
+        auto passes = (*_config)["passes"].GetArray();
+        for (const auto& pass : passes) {
+            float scale = pass.HasMember("scale") ? pass["scale"].GetFloat() : 1.0f;
+            _passes.push_back(Pass{manager->load<resources::ProgramResource>(pass["program"].GetString()),
+                                   std::clamp(scale, 0.01f, 1.0f), nullptr});
+        }
+    }
+    catch (...) {
+        auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+        logger->log("Can't create post process " + name + ".");
+        logger->flush();
+    }
+
+    glGenVertexArrays(1, &_vao);
+}
+
+PostProcess::~PostProcess() {
+    auto manager = resources::ResourcesManager::getInstance();
+    for (auto& pass : _passes) {
+        manager->release(pass.program);
+        delete pass.target;
+        pass.target = nullptr;
+    }
+    _passes.clear();
+
+    delete _scene;
+    _scene = nullptr;
+
+    glDeleteVertexArrays(1, &_vao);
+    manager->release(_config);
+}
+
+void PostProcess::begin(const glm::ivec2& size, const Color& color) {
+    if (_scene == nullptr || _scene->getSize() != size) {
+        resize(size);
+    }
+
+    _scene->bind();
+    glClearColor(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void PostProcess::end() {
+    auto renderer = Renderer::getInstance();
+    const RenderTarget* input = _scene;
+
+    glDisable(GL_BLEND);
+    renderer->bindVertexArray(_vao);
+    for (const auto& pass : _passes) {
+        if (pass.target != nullptr) {
+            pass.target->bind();
+        }
+        else {
+            RenderTarget::unbind();
+            Adaptor::getInstance()->update();
+        }
+
+        auto program = pass.program->get();
+        renderer->useProgram(program);
+        if (program->hasUniform("scene")) {
+            glActiveTexture(GL_TEXTURE1);
+            glBindTexture(GL_TEXTURE_2D, _scene->getTexture());
+            program->setInteger("scene", 1);
+            // renderer only switches to unit 0 when the bound texture changes
+            glActiveTexture(GL_TEXTURE0);
+        }
+        if (program->hasUniform("texel")) {
+            auto input_size = input->getSize();
+            program->setFloat2("texel", 1.0f / input_size.x, 1.0f / input_size.y);
+        }
+
+        renderer->bindTexture(input->getTexture());
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        if (pass.target != nullptr) {
+            input = pass.target;
+        }
+    }
+
+    glEnable(GL_BLEND);
+}
+
+void PostProcess::resize(const glm::ivec2& size) {
+    delete _scene;
+    _scene = new RenderTarget(size);
+
+    for (size_t i = 0; i < _passes.size(); i++) {
+        auto& pass = _passes[i];
+        delete pass.target;
+        pass.target = nullptr;
+
+        if (i + 1 < _passes.size()) {
+            auto pass_size = glm::max(glm::ivec2{glm::vec2{size} * pass.scale}, glm::ivec2{1, 1});
+            pass.target = new RenderTarget(pass_size);
+        }
+    }
+}
+
+} // namespace ngind::rendering
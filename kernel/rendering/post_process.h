@@ -0,0 +1,136 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file post_process.h
+
+
+#ifndef NGIND_POST_PROCESS_H
+#define NGIND_POST_PROCESS_H
+
+#include <string>
+#include <vector>
+
+#include "render_target.h"
+#include "color.h"
+#include "resources/config_resource.h"
+#include "resources/program_resource.h"
+
+namespace ngind::rendering {
+
+/**
+ * Chain of full screen passes applied to the rendered scene. The chain is configured in
+ * resources/config/post_process/<name>.json:
+ * { "passes": [ { "program": "blur", "scale": 0.5 }, { "program": "post_process" } ] }
+ * Each pass samples the output of previous pass as "image" and the scene as "scene", and
+ * gets the texel size of its input in "texel" if the program declares these uniforms.
+ * A pass with scale less than 1 renders into a downsampled buffer. The last pass draws
+ * to the screen, so its scale is ignored.
+ */
+class PostProcess {
+public:
+    /**
+     * Path of chain configuration files under configuration directory
+     */
+    constexpr static char POST_PROCESS_CONFIG_PATH[] = "post_process/";
+
+    /**
+     * @param name: name of the chain
+     */
+    explicit PostProcess(const std::string& name);
+
+    ~PostProcess();
+
+    PostProcess(const PostProcess&) = delete;
+    PostProcess& operator= (const PostProcess&) = delete;
+
+    /**
+     * Redirect drawing into the scene buffer, and clear it.
+     * @param size: size of the scene in pixels
+     * @param color: background color
+     */
+    void begin(const glm::ivec2& size, const Color& color);
+
+    /**
+     * Run all passes and draw the result to the screen.
+     */
+    void end();
+
+    /**
+     * Check if there is any pass.
+     * @return bool, true if the chain is empty
+     */
+    inline bool isEmpty() const {
+        return _passes.empty();
+    }
+
+private:
+    /**
+     * A full screen pass.
+     */
+    struct Pass {
+        /**
+         * Program drawing this pass
+         */
+        resources::ProgramResource* program;
+
+        /**
+         * Scale of output buffer, relative to the scene
+         */
+        float scale;
+
+        /**
+         * Output buffer, or nullptr if it draws to the screen
+         */
+        RenderTarget* target;
+    };
+
+    /**
+     * Chain configuration
+     */
+    resources::ConfigResource* _config;
+
+    /**
+     * Passes in order
+     */
+    std::vector<Pass> _passes;
+
+    /**
+     * Buffer receiving the scene
+     */
+    RenderTarget* _scene;
+
+    /**
+     * Empty vertices array object. Full screen triangles are generated in vertex shader.
+     */
+    GLuint _vao;
+
+    /**
+     * Recreate buffers for a new scene size.
+     * @param size: size of the scene in pixels
+     */
+    void resize(const glm::ivec2& size);
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_POST_PROCESS_H
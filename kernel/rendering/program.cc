@@ -30,7 +30,7 @@
 
 namespace ngind::rendering {
 
-Program::Program(const std::string& program_name) {
+Program::Program(const std::string& program_name) : _frame(0) {
     auto manager = resources::ResourcesManager::getInstance();
     _program_config = manager->load<resources::ConfigResource>("programs/" + program_name + ".json");
 
@@ -51,6 +51,9 @@ Program::Program(const std::string& program_name) {
         logger->log("Can't link program: " + std::string{info});
         logger->flush();
     }
+
+    this->resolveUniforms();
+    this->parseArguments();
 }
 
 Program::~Program() {
@@ -63,79 +66,122 @@ Program::~Program() {
 }
 
 GLint Program::getUniform(const std::string& name) const {
-    auto res = glGetUniformLocation(this->_program, name.c_str());
-    if (res == -1) {
+    auto it = _uniforms.find(name);
+    if (it == _uniforms.end()) {
         auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
         logger->log("Unknown uniform variable " + name + ".");
         logger->flush();
+        return -1;
     }
 
-    return res;
+    return it->second;
 }
 
-void Program::prepare() {
+void Program::resolveUniforms() {
+    GLint number = 0, max_length = 0;
+    glGetProgramiv(this->_program, GL_ACTIVE_UNIFORMS, &number);
+    glGetProgramiv(this->_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+
+    std::vector<GLchar> buffer(max_length + 1);
+    for (GLint i = 0; i < number; i++) {
+        GLint size; GLenum type; GLsizei length = 0;
+        glGetActiveUniform(this->_program, i, buffer.size(), &length, &size, &type, buffer.data());
+
+        std::string name{buffer.data(), static_cast<size_t>(length)};
+        auto location = glGetUniformLocation(this->_program, name.c_str());
+        if (location == -1) { // uniform variables in blocks have no location
+            continue;
+        }
+
+        _uniforms[name] = location;
+        auto pos = name.find("[0]");
+        if (pos != std::string::npos) {
+            _uniforms[name.substr(0, pos)] = location;
+        }
+    }
+
+    auto block = glGetUniformBlockIndex(this->_program, FRAME_BLOCK_NAME);
+    if (block != GL_INVALID_INDEX) {
+        glUniformBlockBinding(this->_program, block, FRAME_BLOCK_BINDING);
+    }
+}
+
+void Program::parseArguments() {
     try {
         auto args = (*_program_config)["args"].GetArray();
         for (const auto& arg : args) {
             std::string name = arg["name"].GetString();
             std::string type = arg["type"].GetString();
+            auto location = this->getUniform(name);
 
             if (type == "float") {
-                this->setFloat(name, arg["value"].GetFloat());
+                auto v = arg["value"].GetFloat();
+                _args.emplace_back([location, v](const Program* program) { program->setFloat(location, v); });
             }
             else if (type == "float2") {
                 auto value = arg["value"].GetArray();
-                this->setFloat2(name, value[0].GetFloat(), value[1].GetFloat());
+                auto v = glm::vec2{value[0].GetFloat(), value[1].GetFloat()};
+                _args.emplace_back([location, v](const Program* program) { program->setFloat2(location, v.x, v.y); });
             }
             else if (type == "float3") {
                 auto value = arg["value"].GetArray();
-                this->setFloat3(name, value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat());
+                auto v = glm::vec3{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat()};
+                _args.emplace_back([location, v](const Program* program) { program->setFloat3(location, v.x, v.y, v.z); });
             }
             else if (type == "float4") {
                 auto value = arg["value"].GetArray();
-                this->setFloat4(name, value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(), value[3].GetFloat());
+                auto v = glm::vec4{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(), value[3].GetFloat()};
+                _args.emplace_back([location, v](const Program* program) { program->setFloat4(location, v.x, v.y, v.z, v.w); });
             }
             else if (type == "int") {
-                this->setInteger(name, arg["value"].GetInt());
+                auto v = arg["value"].GetInt();
+                _args.emplace_back([location, v](const Program* program) { program->setInteger(location, v); });
             }
             else if (type == "int2") {
                 auto value = arg["value"].GetArray();
-                this->setFloat2(name, value[0].GetInt(), value[1].GetInt());
+                auto v = glm::ivec2{value[0].GetInt(), value[1].GetInt()};
+                _args.emplace_back([location, v](const Program* program) { program->setInteger2(location, v.x, v.y); });
             }
             else if (type == "int3") {
                 auto value = arg["value"].GetArray();
-                this->setFloat3(name, value[0].GetInt(), value[1].GetInt(), value[2].GetInt());
+                auto v = glm::ivec3{value[0].GetInt(), value[1].GetInt(), value[2].GetInt()};
+                _args.emplace_back([location, v](const Program* program) { program->setInteger3(location, v.x, v.y, v.z); });
             }
             else if (type == "int4") {
                 auto value = arg["value"].GetArray();
-                this->setFloat4(name, value[0].GetInt(), value[1].GetInt(), value[2].GetInt(), value[3].GetInt());
+                auto v = glm::ivec4{value[0].GetInt(), value[1].GetInt(), value[2].GetInt(), value[3].GetInt()};
+                _args.emplace_back([location, v](const Program* program) { program->setInteger4(location, v.x, v.y, v.z, v.w); });
             }
             else if (type == "unsigned") {
-                this->setUnsigned(name, arg["value"].GetUint());
+                auto v = arg["value"].GetUint();
+                _args.emplace_back([location, v](const Program* program) { program->setUnsigned(location, v); });
             }
             else if (type == "unsigned2") {
                 auto value = arg["value"].GetArray();
-                this->setUnsigned2(name, value[0].GetUint(), value[1].GetUint());
+                auto v = glm::uvec2{value[0].GetUint(), value[1].GetUint()};
+                _args.emplace_back([location, v](const Program* program) { program->setUnsigned2(location, v.x, v.y); });
             }
             else if (type == "unsigned3") {
                 auto value = arg["value"].GetArray();
-                this->setUnsigned3(name, value[0].GetUint(), value[1].GetUint(), value[2].GetUint());
+                auto v = glm::uvec3{value[0].GetUint(), value[1].GetUint(), value[2].GetUint()};
+                _args.emplace_back([location, v](const Program* program) { program->setUnsigned3(location, v.x, v.y, v.z); });
             }
             else if (type == "unsigned4") {
                 auto value = arg["value"].GetArray();
-                this->setUnsigned4(name, value[0].GetUint(), value[1].GetUint(), value[2].GetUint(), value[3].GetUint());
+                auto v = glm::uvec4{value[0].GetUint(), value[1].GetUint(), value[2].GetUint(), value[3].GetUint()};
+                _args.emplace_back([location, v](const Program* program) { program->setUnsigned4(location, v.x, v.y, v.z, v.w); });
             }
             else if (type == "matrix2") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat2{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(), value[3].GetFloat()};
-                this->setMatrix2(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix2(location, mat); });
             }
             else if (type == "matrix3") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat3{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(),
                                      value[3].GetFloat(), value[4].GetFloat(), value[5].GetFloat(),
                                      value[6].GetFloat(), value[7].GetFloat(), value[8].GetFloat()};
-                this->setMatrix3(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix3(location, mat); });
             }
             else if (type == "matrix4") {
                 auto value = arg["value"].GetArray();
@@ -143,53 +189,66 @@ void Program::prepare() {
                                      value[4].GetFloat(), value[5].GetFloat(),value[6].GetFloat(), value[7].GetFloat(),
                                      value[8].GetFloat(), value[9].GetFloat(), value[10].GetFloat(), value[11].GetFloat(),
                                      value[12].GetFloat(), value[13].GetFloat(), value[14].GetFloat(), value[15].GetFloat()};
-                this->setMatrix4(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix4(location, mat); });
             }
             else if (type == "matrix23") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat2x3{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(),
                                        value[3].GetFloat(), value[4].GetFloat(), value[5].GetFloat()};
-                this->setMatrix2x3(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix2x3(location, mat); });
             }
             else if (type == "matrix24") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat2x4{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(), value[3].GetFloat(),
                                        value[4].GetFloat(), value[5].GetFloat(), value[6].GetFloat(), value[7].GetFloat()};
-                this->setMatrix2x4(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix2x4(location, mat); });
             }
             else if (type == "matrix32") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat3x2{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(),
                                        value[3].GetFloat(), value[4].GetFloat(), value[5].GetFloat()};
-                this->setMatrix3x2(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix3x2(location, mat); });
             }
             else if (type == "matrix34") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat3x4{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(), value[3].GetFloat(),
                                        value[4].GetFloat(), value[5].GetFloat(), value[6].GetFloat(), value[7].GetFloat(),
                                        value[8].GetFloat(), value[9].GetFloat(), value[10].GetFloat(), value[11].GetFloat()};
-                this->setMatrix3x4(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix3x4(location, mat); });
             }
             else if (type == "matrix42") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat4x2{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(), value[3].GetFloat(),
                                        value[4].GetFloat(), value[5].GetFloat(), value[6].GetFloat(), value[7].GetFloat()};
-                this->setMatrix4x2(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix4x2(location, mat); });
             }
             else if (type == "matrix43") {
                 auto value = arg["value"].GetArray();
                 auto mat = glm::mat4x3{value[0].GetFloat(), value[1].GetFloat(), value[2].GetFloat(), value[3].GetFloat(),
                                        value[4].GetFloat(), value[5].GetFloat(), value[6].GetFloat(), value[7].GetFloat(),
                                        value[8].GetFloat(), value[9].GetFloat(), value[10].GetFloat(), value[11].GetFloat()};
-                this->setMatrix4x3(name, mat);
+                _args.emplace_back([location, mat](const Program* program) { program->setMatrix4x3(location, mat); });
             }
         }
     }
     catch (...) {
         auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
-        logger->log("Program initialization failed.");
+        logger->log("Can't parse program arguments.");
         logger->flush();
     }
 }
 
+bool Program::prepare(const size_t& frame) {
+    if (_frame == frame) {
+        return false;
+    }
+
+    for (const auto& arg : _args) {
+        arg(this);
+    }
+
+    _frame = frame;
+    return true;
+}
+
 } // namespace ngind::rendering
\ No newline at end of file
@@ -27,6 +27,9 @@
 #define NGIND_PROGRAM_H
 
 #include <string>
+#include <vector>
+#include <functional>
+#include <unordered_map>
 
 #include "resources/shader_resource.h"
 #include "resources/config_resource.h"
@@ -41,6 +44,16 @@ namespace ngind::rendering {
  */
 class Program {
 public:
+    /**
+     * Name of the std140 uniform block holding per-frame data shared by all programs
+     */
+    constexpr static char FRAME_BLOCK_NAME[] = "Frame";
+
+    /**
+     * Binding point of the per-frame uniform block
+     */
+    constexpr static GLuint FRAME_BLOCK_BINDING = 0;
+
     /**
      * @param name: program's name
      */
@@ -59,19 +72,55 @@ public:
     }
 
     /**
-     * Get Uniform variable's index by given name
+     * Get the index of program
+     * @return GLuint, the index of program
+     */
+    inline GLuint getID() const {
+        return this->_program;
+    }
+
+    /**
+     * Get Uniform variable's location by given name. Locations are resolved once when the program is linked.
      * @param name: the given name
-     * @return GLint, the uniform variable's index
+     * @return GLint, the uniform variable's location, -1 if not found
      */
     GLint getUniform(const std::string& name) const;
 
+    /**
+     * Check if the program has an active uniform variable.
+     * @param name: the given name
+     * @return bool, true if the variable exists
+     */
+    inline bool hasUniform(const std::string& name) const {
+        return _uniforms.find(name) != _uniforms.end();
+    }
+
+    /**
+     * Set float uniform variable
+     * @param location: variable's location
+     * @param f: the given value
+     */
+    inline void setFloat(const GLint& location, const float& f) const {
+        glUniform1f(location, f);
+    }
+
     /**
      * Set float uniform variable
      * @param name: variable's name
      * @param f: the given value
      */
     inline void setFloat(const std::string& name, const float& f) const {
-        glUniform1f(getUniform(name), f);
+        setFloat(getUniform(name), f);
+    }
+
+    /**
+     * Set 2 float properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     */
+    inline void setFloat2(const GLint& location, const float& x, const float& y) const {
+        glUniform2f(location, x, y);
     }
 
     /**
@@ -81,7 +130,18 @@ public:
      * @param y: the second property
      */
     inline void setFloat2(const std::string& name, const float& x, const float& y) const {
-        glUniform2f(getUniform(name), x, y);
+        setFloat2(getUniform(name), x, y);
+    }
+
+    /**
+     * Set 3 float properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     * @param z: the third property
+     */
+    inline void setFloat3(const GLint& location, const float& x, const float& y, const float& z) const {
+        glUniform3f(location, x, y, z);
     }
 
     /**
@@ -92,7 +152,19 @@ public:
      * @param z: the third property
      */
     inline void setFloat3(const std::string& name, const float& x, const float& y, const float& z) const {
-        glUniform3f(getUniform(name), x, y, z);
+        setFloat3(getUniform(name), x, y, z);
+    }
+
+    /**
+     * Set 4 float properties in this program
+     * @param location: location of property
+     * @param r: the first property
+     * @param g: the second property
+     * @param b: the third property
+     * @param a: the fourth property
+     */
+    inline void setFloat4(const GLint& location, const float& r, const float& g, const float& b, const float& a) const {
+        glUniform4f(location, r, g, b, a);
     }
 
     /**
@@ -104,7 +176,16 @@ public:
      * @param a: the fourth property
      */
     inline void setFloat4(const std::string& name, const float& r, const float& g, const float& b, const float& a) const {
-        glUniform4f(getUniform(name), r, g, b, a);
+        setFloat4(getUniform(name), r, g, b, a);
+    }
+
+    /**
+     * Set integer uniform property in this program
+     * @param location: location of property
+     * @param i: integer data
+     */
+    inline void setInteger(const GLint& location, const int& i) const {
+        glUniform1i(location, i);
     }
 
     /**
@@ -113,7 +194,17 @@ public:
      * @param i: integer data
      */
     inline void setInteger(const std::string& name, const int& i) const {
-        glUniform1i(getUniform(name), i);
+        setInteger(getUniform(name), i);
+    }
+
+    /**
+     * Set 2 integer uniform properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     */
+    inline void setInteger2(const GLint& location, const int& x, const int& y) const {
+        glUniform2i(location, x, y);
     }
 
     /**
@@ -123,7 +214,18 @@ public:
      * @param y: the second property
      */
     inline void setInteger2(const std::string& name, const int& x, const int& y) const {
-        glUniform2i(getUniform(name), x, y);
+        setInteger2(getUniform(name), x, y);
+    }
+
+    /**
+     * Set 3 integer uniform properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     * @param z: the third property
+     */
+    inline void setInteger3(const GLint& location, const int& x, const int& y, const int& z) const {
+        glUniform3i(location, x, y, z);
     }
 
     /**
@@ -134,7 +236,19 @@ public:
      * @param z: the third property
      */
     inline void setInteger3(const std::string& name, const int& x, const int& y, const int& z) const {
-        glUniform3i(getUniform(name), x, y, z);
+        setInteger3(getUniform(name), x, y, z);
+    }
+
+    /**
+     * Set 4 integer uniform properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     * @param z: the third property
+     * @param w: the forth property
+     */
+    inline void setInteger4(const GLint& location, const int& x, const int& y, const int& z, const int& w) const {
+        glUniform4i(location, x, y, z, w);
     }
 
     /**
@@ -146,7 +260,16 @@ public:
      * @param w: the forth property
      */
     inline void setInteger4(const std::string& name, const int& x, const int& y, const int& z, const int& w) const {
-        glUniform4i(getUniform(name), x, y, z, w);
+        setInteger4(getUniform(name), x, y, z, w);
+    }
+
+    /**
+     * Set unsigned integer uniform property in this program
+     * @param location: location of property
+     * @param i: integer data
+     */
+    inline void setUnsigned(const GLint& location, const unsigned& i) const {
+        glUniform1ui(location, i);
     }
 
     /**
@@ -155,7 +278,17 @@ public:
      * @param i: integer data
      */
     inline void setUnsigned(const std::string& name, const unsigned& i) const {
-        glUniform1ui(getUniform(name), i);
+        setUnsigned(getUniform(name), i);
+    }
+
+    /**
+     * Set 2 unsigned integer uniform properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     */
+    inline void setUnsigned2(const GLint& location, const unsigned& x, const unsigned& y) const {
+        glUniform2ui(location, x, y);
     }
 
     /**
@@ -165,7 +298,18 @@ public:
      * @param y: the second property
      */
     inline void setUnsigned2(const std::string& name, const unsigned& x, const unsigned& y) const {
-        glUniform2ui(getUniform(name), x, y);
+        setUnsigned2(getUniform(name), x, y);
+    }
+
+    /**
+     * Set 3 unsigned integer uniform properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     * @param z: the third property
+     */
+    inline void setUnsigned3(const GLint& location, const unsigned& x, const unsigned& y, const unsigned& z) const {
+        glUniform3ui(location, x, y, z);
     }
 
     /**
@@ -176,7 +320,19 @@ public:
      * @param z: the third property
      */
     inline void setUnsigned3(const std::string& name, const unsigned& x, const unsigned& y, const unsigned& z) const {
-        glUniform3ui(getUniform(name), x, y, z);
+        setUnsigned3(getUniform(name), x, y, z);
+    }
+
+    /**
+     * Set 4 unsigned integer uniform properties in this program
+     * @param location: location of property
+     * @param x: the first property
+     * @param y: the second property
+     * @param z: the third property
+     * @param w: the forth property
+     */
+    inline void setUnsigned4(const GLint& location, const unsigned& x, const unsigned& y, const unsigned& z, const unsigned& w) const {
+        glUniform4ui(location, x, y, z, w);
     }
 
     /**
@@ -188,7 +344,16 @@ public:
      * @param w: the forth property
      */
     inline void setUnsigned4(const std::string& name, const unsigned& x, const unsigned& y, const unsigned& z, const unsigned& w) const {
-        glUniform4ui(getUniform(name), x, y, z, w);
+        setUnsigned4(getUniform(name), x, y, z, w);
+    }
+
+    /**
+     * Set 2x2 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix2(const GLint& location, const glm::mat2& m) const {
+        glUniformMatrix2fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -197,7 +362,16 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix2(const std::string& name, const glm::mat2& m) const {
-        glUniformMatrix2fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix2(getUniform(name), m);
+    }
+
+    /**
+     * Set 3x3 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix3(const GLint& location, const glm::mat3& m) const {
+        glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -206,7 +380,16 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix3(const std::string& name, const glm::mat3& m) const {
-        glUniformMatrix3fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix3(getUniform(name), m);
+    }
+
+    /**
+     * Set 4x4 matrix uniform property in this program
+     * @param location: location of property
+     * @param m: matrix4 data
+     */
+    inline void setMatrix4(const GLint& location, const glm::mat4& m) const {
+        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -215,7 +398,16 @@ public:
      * @param m: matrix4 data
      */
     inline void setMatrix4(const std::string& name, const glm::mat4& m) const {
-        glUniformMatrix4fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix4(getUniform(name), m);
+    }
+
+    /**
+     * Set 2x3 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix2x3(const GLint& location, const glm::mat2x3 & m) const {
+        glUniformMatrix2x3fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -224,7 +416,16 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix2x3(const std::string& name, const glm::mat2x3 & m) const {
-        glUniformMatrix2x3fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix2x3(getUniform(name), m);
+    }
+
+    /**
+     * Set 3x2 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix3x2(const GLint& location, const glm::mat3x2 & m) const {
+        glUniformMatrix3x2fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -233,7 +434,16 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix3x2(const std::string& name, const glm::mat3x2 & m) const {
-        glUniformMatrix3x2fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix3x2(getUniform(name), m);
+    }
+
+    /**
+     * Set 2x4 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix2x4(const GLint& location, const glm::mat2x4 & m) const {
+        glUniformMatrix2x4fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -242,7 +452,16 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix2x4(const std::string& name, const glm::mat2x4 & m) const {
-        glUniformMatrix2x4fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix2x4(getUniform(name), m);
+    }
+
+    /**
+     * Set 4x2 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix4x2(const GLint& location, const glm::mat4x2 & m) const {
+        glUniformMatrix4x2fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -251,7 +470,16 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix4x2(const std::string& name, const glm::mat4x2 & m) const {
-        glUniformMatrix4x2fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix4x2(getUniform(name), m);
+    }
+
+    /**
+     * Set 3x4 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix3x4(const GLint& location, const glm::mat3x4 & m) const {
+        glUniformMatrix3x4fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -260,7 +488,16 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix3x4(const std::string& name, const glm::mat3x4 & m) const {
-        glUniformMatrix3x4fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix3x4(getUniform(name), m);
+    }
+
+    /**
+     * Set 4x3 matrix uniform property
+     * @param location: location of property
+     * @param m: the matrix
+     */
+    inline void setMatrix4x3(const GLint& location, const glm::mat4x3 & m) const {
+        glUniformMatrix4x3fv(location, 1, GL_FALSE, glm::value_ptr(m));
     }
 
     /**
@@ -269,13 +506,15 @@ public:
      * @param m: the matrix
      */
     inline void setMatrix4x3(const std::string& name, const glm::mat4x3 & m) const {
-        glUniformMatrix4x3fv(getUniform(name), 1, GL_FALSE, glm::value_ptr(m));
+        setMatrix4x3(getUniform(name), m);
     }
 
     /**
-     * Prepare uniform variables.
+     * Upload static arguments in the configuration. Arguments are uploaded only once per frame.
+     * @param frame: index of current frame
+     * @return bool, true if arguments are uploaded in this call
      */
-    void prepare();
+    bool prepare(const size_t& frame);
 
 private:
     /**
@@ -297,6 +536,31 @@ private:
      * Program configuration
      */
     resources::ConfigResource* _program_config;
+
+    /**
+     * Locations of active uniform variables
+     */
+    std::unordered_map<std::string, GLint> _uniforms;
+
+    /**
+     * Static arguments parsed from configuration
+     */
+    std::vector<std::function<void(const Program*)>> _args;
+
+    /**
+     * Index of the last frame in which arguments were uploaded
+     */
+    size_t _frame;
+
+    /**
+     * Query locations of all active uniform variables and bind the per-frame uniform block.
+     */
+    void resolveUniforms();
+
+    /**
+     * Parse static arguments in the configuration.
+     */
+    void parseArguments();
 };
 
 } // namespace ngind::rendering
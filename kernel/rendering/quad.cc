@@ -24,57 +24,29 @@
 /// @file quad.h
 
 #include "quad.h"
+
+#include <algorithm>
+
 #include "log/logger_factory.h"
 
 namespace ngind::rendering {
 
-Quad::Quad(std::initializer_list<GLfloat> vs) : AutoCollectionObject() {
-    _size = vs.size();
+Quad::Quad(std::initializer_list<GLfloat> vs) : Quad(std::vector<GLfloat>{vs}) {
+}
 
-    if (_size == 0) {
+Quad::Quad(std::vector<GLfloat> vs) : AutoCollectionObject(), _vertices(std::move(vs)), _bounds() {
+    if (_vertices.empty() || _vertices.size() % 16 != 0) {
         auto logger = log::LoggerFactory::getInstance()->getLogger("waring.log", log::LogLevel::LOG_LEVEL_WARNING);
-        logger->log("Empty quad data.");
+        logger->log("Invalid quad data.");
         logger->flush();
+        return;
     }
-    else {
-        glGenVertexArrays(1, &_vao);
-        glGenBuffers(1, &_vbo);
-
-        _vertex = new GLfloat[_size];
-        auto it = vs.begin();
-        for (int i = 0; i < _size; i++, it++) {
-            _vertex[i] = *it;
-        }
-
-        glGenBuffers(1, &_ebo);
-        glBindVertexArray(_vao);
-
-        glBindBuffer(GL_ARRAY_BUFFER, _vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * _size, _vertex, GL_STATIC_DRAW);
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
-        constexpr GLuint indices[] = {
-                0, 1, 3,
-                1, 2, 3
-        };
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), reinterpret_cast<GLvoid*>(0));
-        glEnableVertexAttribArray(0);
-
-        glBindVertexArray(0);
-
-        delete[] _vertex;
-        _vertex = nullptr;
+    _bounds = {_vertices[0], _vertices[1], _vertices[0], _vertices[1]};
+    for (size_t i = 4; i < _vertices.size(); i += 4) {
+        _bounds.x = std::min(_bounds.x, _vertices[i]); _bounds.y = std::min(_bounds.y, _vertices[i + 1]);
+        _bounds.z = std::max(_bounds.z, _vertices[i]); _bounds.w = std::max(_bounds.w, _vertices[i + 1]);
     }
 }
 
-Quad::~Quad() {
-    glDeleteVertexArrays(1, &_vao);
-    glDeleteBuffers(1, &_vbo);
-
-    if (_size) {
-        glDeleteBuffers(1, &_ebo);
-    }
-}
 } // namespace ngind::rendering
\ No newline at end of file
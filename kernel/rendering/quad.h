@@ -29,7 +29,7 @@
 #include "GL/glew.h"
 
 #include <initializer_list>
-#include <cstdio>
+#include <vector>
 
 #include "rendering/color.h"
 #include "glm/glm.hpp"
@@ -40,61 +40,60 @@ namespace ngind::rendering {
 class Renderer;
 
 /**
- * The quad data to be rendered.
+ * The quad data to be rendered. Every four vertices form one quad, and each vertex
+ * contains position (x, y) and texture coordinate (u, v) in the local space.
+ * The data only lives in memory, the renderer will transform and upload them in batches.
  */
 class Quad : public memory::AutoCollectionObject {
 public:
     /**
      * @param vs: the data of vertices
-     * @param color_size: the number of color channel
      */
     explicit Quad(std::initializer_list<GLfloat> vs);
 
-    ~Quad();
+    /**
+     * @param vs: the data of vertices
+     */
+    explicit Quad(std::vector<GLfloat> vs);
+
+    ~Quad() override = default;
 
     Quad(const Quad&) = delete;
     Quad& operator= (const Quad&) = delete;
 
     /**
-     * Get the vertices array object index
-     * @return GLuint, the index of vao
+     * Get the vertices data.
+     * @return const GLfloat*, the pointer to vertices data
      */
-    inline GLuint getVAO() const {
-        return _vao;
+    inline const GLfloat* getVertices() const {
+        return _vertices.data();
     }
 
     /**
-     * Get the vertices buffer object index
-     * @return GLuint, the index of vbo
+     * Get the number of quads in this data.
+     * @return size_t, the number of quads
      */
-    inline GLuint getVBO() const {
-        return _vbo;
+    inline size_t getQuadsNumber() const {
+        return _vertices.size() / 16;
     }
-private:
-    /**
-     * The vertices array object
-     */
-    GLuint _vao;
 
     /**
-     * The vertices buffer object
+     * Get the bounding rectangle of all vertices in the local space.
+     * @return glm::vec4, the rectangle (left, bottom, right, top)
      */
-    GLuint _vbo;
-
-    /**
-     * The element buffer object
-     */
-    GLuint _ebo;
-
+    inline glm::vec4 getBounds() const {
+        return _bounds;
+    }
+private:
     /**
      * The vertex array
      */
-    GLfloat* _vertex;
+    std::vector<GLfloat> _vertices;
 
     /**
-     * Size of vertex
+     * Bounding rectangle of vertices
      */
-    size_t _size;
+    glm::vec4 _bounds;
 };
 
 } // namespace ngind::rendering
@@ -0,0 +1,105 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file quad_instancer.cc
+
+#include "quad_instancer.h"
+
+#include <cstddef>
+
+#include "renderer.h"
+
+namespace ngind::rendering {
+
+QuadInstancer::QuadInstancer() : _vao(0), _quad_vbo(0), _ebo(0), _instance_vbo(0),
+_instances(), _draw_calls(0), _quads(0) {
+    _instances.reserve(MAX_INSTANCES_NUMBER);
+
+    constexpr GLfloat corners[] = {1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    constexpr GLuint indices[] = {0, 1, 3, 1, 2, 3};
+
+    glGenVertexArrays(1, &_vao);
+    glGenBuffers(1, &_quad_vbo);
+    glGenBuffers(1, &_ebo);
+    glGenBuffers(1, &_instance_vbo);
+
+    glBindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _quad_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), nullptr);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ARRAY_BUFFER, _instance_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(Instance) * MAX_INSTANCES_NUMBER, nullptr, GL_STREAM_DRAW);
+    for (GLuint i = 0; i < 4; i++) { // a matrix takes four attribute locations
+        glVertexAttribPointer(2 + i, 4, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                              reinterpret_cast<GLvoid*>(offsetof(Instance, model) + sizeof(glm::vec4) * i));
+        glEnableVertexAttribArray(2 + i);
+        glVertexAttribDivisor(2 + i, 1);
+    }
+    glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<GLvoid*>(offsetof(Instance, uv)));
+    glEnableVertexAttribArray(6);
+    glVertexAttribDivisor(6, 1);
+    glVertexAttribPointer(7, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), reinterpret_cast<GLvoid*>(offsetof(Instance, r)));
+    glEnableVertexAttribArray(7);
+    glVertexAttribDivisor(7, 1);
+
+    glBindVertexArray(0);
+}
+
+QuadInstancer::~QuadInstancer() {
+    glDeleteVertexArrays(1, &_vao);
+    glDeleteBuffers(1, &_quad_vbo);
+    glDeleteBuffers(1, &_ebo);
+    glDeleteBuffers(1, &_instance_vbo);
+}
+
+void QuadInstancer::push(const glm::mat4& model, const glm::vec4& uv, const Color& color) {
+    if (_instances.size() == MAX_INSTANCES_NUMBER) {
+        flush();
+    }
+
+    _instances.push_back(Instance{model, uv, color.r, color.g, color.b, color.a});
+}
+
+void QuadInstancer::flush() {
+    if (_instances.empty()) {
+        return;
+    }
+
+    Renderer::getInstance()->bindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _instance_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(Instance) * MAX_INSTANCES_NUMBER, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Instance) * _instances.size(), _instances.data());
+
+    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, _instances.size());
+
+    _draw_calls++;
+    _quads += _instances.size();
+    _instances.clear();
+}
+
+} // namespace ngind::rendering
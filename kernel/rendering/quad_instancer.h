@@ -0,0 +1,159 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file quad_instancer.h
+
+#ifndef NGIND_QUAD_INSTANCER_H
+#define NGIND_QUAD_INSTANCER_H
+
+#include "GL/glew.h"
+
+#include <vector>
+
+#include "color.h"
+#include "glm/glm.hpp"
+
+namespace ngind::rendering {
+
+/**
+ * Instanced renderer for quads sharing one static unit quad. Model matrices, texture
+ * rectangles and colors are streamed as per-instance attributes, and instances sharing
+ * the same program, texture and blend state are submitted with a single draw call.
+ */
+class QuadInstancer {
+public:
+    /**
+     * Max number of instances in one draw call.
+     */
+    constexpr static size_t MAX_INSTANCES_NUMBER = 4096;
+
+    QuadInstancer();
+    ~QuadInstancer();
+
+    QuadInstancer(const QuadInstancer&) = delete;
+    QuadInstancer& operator= (const QuadInstancer&) = delete;
+
+    /**
+     * Append an instance. If the buffer is full, it will be flushed automatically.
+     * @param model: the model matrix, which maps unit quad to local space
+     * @param uv: texture coordinates of left bottom and right top corners
+     * @param color: the color of quad
+     */
+    void push(const glm::mat4& model, const glm::vec4& uv, const Color& color);
+
+    /**
+     * Draw all instances with current OpenGL state and clear the buffer.
+     */
+    void flush();
+
+    /**
+     * Check if there is nothing to be drawn.
+     * @return bool, true if no instance
+     */
+    inline bool isEmpty() const {
+        return _instances.empty();
+    }
+
+    /**
+     * Get the number of draw calls since last reset.
+     * @return size_t, the number of draw calls
+     */
+    inline size_t getDrawCallsNumber() const {
+        return _draw_calls;
+    }
+
+    /**
+     * Get the number of quads drawn since last reset.
+     * @return size_t, the number of quads
+     */
+    inline size_t getQuadsNumber() const {
+        return _quads;
+    }
+
+    /**
+     * Reset statistics data.
+     */
+    inline void resetStatistics() {
+        _draw_calls = 0;
+        _quads = 0;
+    }
+private:
+    /**
+     * Per-instance attributes layout.
+     */
+    struct Instance {
+        /**
+         * Model matrix
+         */
+        glm::mat4 model;
+
+        /**
+         * Texture coordinates of corners
+         */
+        glm::vec4 uv;
+
+        /**
+         * Color of quad.
+         */
+        GLubyte r, g, b, a;
+    };
+
+    /**
+     * The vertices array object
+     */
+    GLuint _vao;
+
+    /**
+     * The static unit quad buffer object
+     */
+    GLuint _quad_vbo;
+
+    /**
+     * The element buffer object
+     */
+    GLuint _ebo;
+
+    /**
+     * The streaming instances buffer object
+     */
+    GLuint _instance_vbo;
+
+    /**
+     * Instances waiting for drawing
+     */
+    std::vector<Instance> _instances;
+
+    /**
+     * Number of draw calls
+     */
+    size_t _draw_calls;
+
+    /**
+     * Number of quads drawn
+     */
+    size_t _quads;
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_QUAD_INSTANCER_H
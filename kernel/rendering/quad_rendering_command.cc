@@ -23,19 +23,34 @@
 
 #include "quad_rendering_command.h"
 
+#include "renderer.h"
+
 namespace ngind::rendering {
 
 QuadRenderingCommand::QuadRenderingCommand(Quad* quad, const GLuint& tid) : RenderingCommand(),
-_quad(quad), _texture(tid) {
+_quad(quad) {
+    this->setTexture(tid);
+}
+
+void QuadRenderingCommand::prepare() {
+    RenderingCommand::prepare();
+    Renderer::getInstance()->bindTexture(this->getTexture());
+}
+
+bool QuadRenderingCommand::getBounds(glm::vec4& bounds) const {
+    bounds = transformBounds(_quad->getBounds());
+    return true;
 }
 
 void QuadRenderingCommand::call() {
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, _texture);
-    glBindVertexArray(_quad->getVAO());
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glBindVertexArray(0);
+    auto batch = Renderer::getInstance()->getSpriteBatch();
+    batch->push(_quad, this->getModel(), this->getColor());
+    batch->flush();
+}
+
+void QuadRenderingCommand::promote() {
+    RenderingCommand::promote();
+    _quad->promote();
 }
 
 } // namespace ngind::rendering
\ No newline at end of file
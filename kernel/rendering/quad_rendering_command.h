@@ -47,16 +47,35 @@ public:
      * @see kernel/rendering/rendering_command.h
      */
     void call() override;
-private:
+
     /**
-     * Quad data
+     * @see kernel/rendering/rendering_command.h
      */
-    Quad* _quad;
+    void prepare() override;
+
+    /**
+     * @see kernel/rendering/rendering_command.h
+     */
+    bool getBounds(glm::vec4& bounds) const override;
 
     /**
-     * Texture id
+     * @see kernel/memory/auto_collection_object.h
      */
-    GLuint _texture;
+    void promote() override;
+
+    /**
+     * Get the quad data.
+     * @return Quad*, the quad data
+     */
+    inline Quad* getQuad() const {
+        return _quad;
+    }
+
+private:
+    /**
+     * Quad data
+     */
+    Quad* _quad;
 };
 
 } // namespace ngind::rendering
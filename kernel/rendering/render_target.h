@@ -0,0 +1,114 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file render_target.h
+
+
+#ifndef NGIND_RENDER_TARGET_H
+#define NGIND_RENDER_TARGET_H
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+namespace ngind::rendering {
+
+/**
+ * Offscreen framebuffer object with a color texture, which can be sampled by later passes.
+ */
+class RenderTarget {
+public:
+    /**
+     * @param size: size of color texture in pixels
+     */
+    explicit RenderTarget(const glm::ivec2& size);
+
+    ~RenderTarget();
+
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator= (const RenderTarget&) = delete;
+
+    /**
+     * Draw into this target, and set viewport to cover the whole texture.
+     */
+    void bind() const;
+
+    /**
+     * Draw into the screen again, which is default framebuffer unless it's redirected by setScreen.
+     */
+    static void unbind();
+
+    /**
+     * Redirect the screen into a render target, used in headless mode.
+     * @param target: the render target, or nullptr for default framebuffer
+     */
+    static void setScreen(const RenderTarget* target);
+
+    /**
+     * Check if the screen is redirected into a render target.
+     * @return bool, true if the screen is offscreen
+     */
+    static inline bool isScreenOffscreen() {
+        return _screen != 0;
+    }
+
+    /**
+     * Get the color texture.
+     * @return GLuint, texture id
+     */
+    inline GLuint getTexture() const {
+        return _texture;
+    }
+
+    /**
+     * Get the size of color texture.
+     * @return glm::ivec2, size in pixels
+     */
+    inline glm::ivec2 getSize() const {
+        return _size;
+    }
+
+private:
+    /**
+     * Framebuffer object used as screen
+     */
+    static GLuint _screen;
+
+    /**
+     * Framebuffer object id
+     */
+    GLuint _framebuffer;
+
+    /**
+     * Color texture id
+     */
+    GLuint _texture;
+
+    /**
+     * Size of color texture
+     */
+    glm::ivec2 _size;
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_RENDER_TARGET_H
@@ -23,11 +23,19 @@
 
 /// @file rendering.cc
 
+#include <vector>
+#include <cstdlib>
+#include <cxxabi.h>
+
 #include "GL/glew.h"
 
 #include "renderer.h"
 #include "camera.h"
+#include "texture_loader.h"
+#include "screen_capture.h"
 #include "log/logger_factory.h"
+#include "timer/profiler.h"
+#include "settings.h"
 
 namespace ngind::rendering {
 Renderer* Renderer::_instance = nullptr;
@@ -55,39 +63,141 @@ void Renderer::destroyInstance() {
 }
 
 Renderer::Renderer()
-    : _window(nullptr), _queue(new RenderingQueue()), _multisampling(true) {
+    : _window(nullptr), _queue(new RenderingQueue()), _multisampling(true),
+    _batch(nullptr), _instancer(nullptr), _batch_command(nullptr), _batch_instanced(false), _draw_calls(0), _quads(0),
+    _culling(true), _submitted(0), _culled(0), _current_submitted(0), _current_culled(0),
+    _offscreen(nullptr), _post_process(nullptr), _gpu_timer(nullptr), _gpu_section(nullptr), _clear_color(), _frame(0),
+    _frame_uniforms(0) {
+    resetStateCache();
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 }
 
 Renderer::~Renderer() {
+    delete _post_process;
+    _post_process = nullptr;
+
+    RenderTarget::setScreen(nullptr);
+    delete _offscreen;
+    _offscreen = nullptr;
+
+    if (_frame_uniforms != 0) {
+        glDeleteBuffers(1, &_frame_uniforms);
+    }
+
+    delete _gpu_timer;
+    _gpu_timer = nullptr;
+
+    delete _batch;
+    _batch = nullptr;
+
+    delete _instancer;
+    _instancer = nullptr;
+
     delete _window;
     _window = nullptr;
 }
 
 bool Renderer::startRenderingLoopOnce() {
+    NGIND_PROFILE_ZONE("Renderer::startRenderingLoopOnce");
     if (this->_window->isLoopEnd()) {
         return false;
     }
 
+    _batch->resetStatistics();
+    _instancer->resetStatistics();
+    _draw_calls = 0;
+    _frame++;
+    TextureLoader::getInstance()->update();
+
+    bool post_process = (_post_process != nullptr && !_post_process->isEmpty());
+    if (post_process) {
+        _post_process->begin(glm::ivec2{Camera::getInstance()->getCameraSize()}, _clear_color);
+    }
+
+    resetStateCache();
+    updateFrameUniforms();
+
     _queue->sort();
+    bool overlay = false;
+    beginGpuSection("queue");
     for (auto cmd : (*_queue)) {
+        if (!overlay && cmd->getZ() >= OVERLAY_Z_ORDER) {
+            this->flush();
+            beginGpuSection("overlay");
+            overlay = true;
+        }
+
         this->execute(cmd);
     }
+    this->flush();
+    _gpu_timer->end();
+
+    if (post_process) {
+        _gpu_timer->begin("post process");
+        _post_process->end();
+        _gpu_timer->end();
+    }
+
+    _draw_calls += _batch->getDrawCallsNumber() + _instancer->getDrawCallsNumber();
+    _quads = _batch->getQuadsNumber() + _instancer->getQuadsNumber();
+
+    _submitted = _current_submitted; _culled = _current_culled;
+    _current_submitted = 0; _current_culled = 0;
 
     _queue->clear();
+    _gpu_timer->begin("swap");
+    ScreenCapture::getInstance()->update();
     this->_window->swapBuffer();
+    _gpu_timer->nextFrame();
+
+#if NGIND_PROFILER
+    auto profiler = timer::Profiler::getInstance();
+    for (const auto& [name, time] : _gpu_timer->getResults()) {
+        profiler->counter("gpu " + name, time);
+    }
+#endif
+
     return true;
 }
 
+void Renderer::setPostProcess(const std::string& name) {
+    delete _post_process;
+    _post_process = name.empty() ? nullptr : new PostProcess(name);
+}
+
+void Renderer::addRendererCommand(RenderingCommand* cmd) {
+    glm::vec4 bounds;
+    if (_culling && cmd->getBounds(bounds)) {
+        auto camera = Camera::getInstance();
+        auto center = camera->getCameraPosition();
+        auto half = camera->getCameraSize() * 0.5f;
+
+        if (bounds.z < center.x - half.x || bounds.x > center.x + half.x ||
+            bounds.w < center.y - half.y || bounds.y > center.y + half.y) {
+            _current_culled++;
+            return;
+        }
+    }
+
+    _current_submitted++;
+    _queue->push(cmd);
+}
+
 void Renderer::createWindow(int screen_width,
                             int screen_height,
                             int resolution_width,
                             int resolution_height,
                             const std::string& title,
                             const std::string& icon,
-                            bool is_full) {
-    this->_window = new Window(screen_width, screen_height, title, is_full);
-    this->_window->setIcon(icon);
+                            bool is_full,
+                            bool headless) {
+    if (headless) {
+        this->_window = new Window(resolution_width, resolution_height, title, false, false);
+    }
+    else {
+        this->_window = new Window(screen_width, screen_height, title, is_full);
+        this->_window->setIcon(icon);
+    }
 
     glewExperimental = GL_TRUE;
     if (glewInit() != GLEW_OK) {
@@ -99,13 +209,142 @@ void Renderer::createWindow(int screen_width,
     glEnable(GL_BLEND);
     setBlendFactor(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glEnable(GL_MULTISAMPLE);
+
+    _batch = new SpriteBatch();
+    _instancer = new QuadInstancer();
+    _gpu_timer = new GpuTimer();
+
+    glGenBuffers(1, &_frame_uniforms);
+    glBindBuffer(GL_UNIFORM_BUFFER, _frame_uniforms);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameUniforms), nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, Program::FRAME_BLOCK_BINDING, _frame_uniforms);
     Camera::getInstance()->init({resolution_width / 2.0f, resolution_height / 2.0f},
                                 resolution_width, resolution_height);
+
+    if (headless) {
+        _offscreen = new RenderTarget({resolution_width, resolution_height});
+        RenderTarget::setScreen(_offscreen);
+    }
+}
+
+uint64_t Renderer::hashFrame() const {
+    auto size = (_offscreen != nullptr) ? _offscreen->getSize() : glm::ivec2{Camera::getInstance()->getCameraSize()};
+    std::vector<unsigned char> pixels(static_cast<size_t>(size.x) * size.y * 4);
+
+    glReadBuffer(RenderTarget::isScreenOffscreen() ? GL_COLOR_ATTACHMENT0 : GL_BACK);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+    uint64_t hash = 14695981039346656037ULL;
+    for (const auto& p : pixels) {
+        hash = (hash ^ p) * 1099511628211ULL;
+    }
+
+    return hash;
 }
 
 void Renderer::execute(RenderingCommand* cmd) {
-    cmd->prepare();
-    cmd->call();
+    auto quad_cmd = dynamic_cast<QuadRenderingCommand*>(cmd);
+    auto instanced_cmd = (quad_cmd == nullptr) ? dynamic_cast<InstancedQuadRenderingCommand*>(cmd) : nullptr;
+    if (quad_cmd == nullptr && instanced_cmd == nullptr) {
+        this->flush();
+        if constexpr (CURRENT_MODE == MODE_DEBUG) {
+            _gpu_timer->begin(getTypeName(cmd), _gpu_section);
+        }
+
+        cmd->prepare();
+        cmd->call();
+        _draw_calls++;
+
+        if constexpr (CURRENT_MODE == MODE_DEBUG) {
+            _gpu_timer->end();
+        }
+        return;
+    }
+
+    bool instanced = (instanced_cmd != nullptr);
+    if (_batch_command == nullptr ||
+        _batch_instanced != instanced ||
+        _batch_command->getProgram() != cmd->getProgram() ||
+        _batch_command->getTexture() != cmd->getTexture() ||
+        _batch_command->getBlendSource() != cmd->getBlendSource() ||
+        _batch_command->getBlendDestination() != cmd->getBlendDestination()) {
+        this->flush();
+        if constexpr (CURRENT_MODE == MODE_DEBUG) {
+            _gpu_timer->begin(getTypeName(cmd), _gpu_section);
+        }
+
+        cmd->prepare();
+        _batch_command = cmd;
+        _batch_instanced = instanced;
+    }
+
+    if (instanced) {
+        _instancer->push(instanced_cmd->getInstanceMatrix(), instanced_cmd->getUV(), instanced_cmd->getColor());
+    }
+    else {
+        _batch->push(quad_cmd->getQuad(), quad_cmd->getModel(), quad_cmd->getColor());
+    }
+}
+
+void Renderer::flush() {
+    _batch->flush();
+    _instancer->flush();
+    _batch_command = nullptr;
+
+    if constexpr (CURRENT_MODE == MODE_DEBUG) {
+        _gpu_timer->end();
+    }
+}
+
+void Renderer::beginGpuSection(const char* name) {
+    _gpu_section = name;
+    if constexpr (CURRENT_MODE != MODE_DEBUG) {
+        _gpu_timer->begin(name);
+    }
+}
+
+const char* Renderer::getTypeName(RenderingCommand* cmd) {
+    std::type_index type{typeid(*cmd)};
+    auto it = _type_names.find(type);
+    if (it == _type_names.end()) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        std::string name = (status == 0 && demangled != nullptr) ? demangled : type.name();
+        std::free(demangled);
+
+        auto pos = name.rfind("::");
+        if (pos != std::string::npos) {
+            name = name.substr(pos + 2);
+        }
+
+        it = _type_names.emplace(type, name).first;
+    }
+
+    return it->second.c_str();
+}
+
+void Renderer::useProgram(Program* program) {
+    if (_current_program != program) {
+        program->use();
+        _current_program = program;
+    }
+
+    program->prepare(_frame);
+}
+
+void Renderer::updateFrameUniforms() {
+    FrameUniforms uniforms{Camera::getInstance()->getProjection()};
+    glBindBuffer(GL_UNIFORM_BUFFER, _frame_uniforms);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniforms), &uniforms);
+}
+
+void Renderer::resetStateCache() {
+    constexpr auto unknown = static_cast<unsigned int>(-1);
+    _current_program = nullptr;
+    _current_texture = unknown;
+    _current_vao = unknown;
+    _blend_src = unknown; _blend_dst = unknown;
 }
 
 void Renderer::enableMultisampling(const bool& en) {
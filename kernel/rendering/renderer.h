@@ -27,9 +27,18 @@
 #define NGIND_RENDERER_H
 
 #include "rendering_queue.h"
+#include "sprite_batch.h"
+#include "quad_instancer.h"
+#include "quad_rendering_command.h"
+#include "instanced_quad_rendering_command.h"
 #include "window.h"
 #include "color.h"
 #include "camera.h"
+#include "post_process.h"
+#include "gpu_timer.h"
+
+#include <map>
+#include <typeindex>
 
 #include "script/lua_registration.h"
 
@@ -41,6 +50,11 @@ namespace ngind::rendering {
  */
 class Renderer {
 public:
+    /**
+     * Commands whose z order is not less than it are drawn as overlay, e.g. the visual logger
+     */
+    static constexpr int OVERLAY_Z_ORDER = 999;
+
     /**
      * Get the instance of rendering
      * @return Renderer*, the instance of rendering
@@ -65,6 +79,7 @@ public:
      * @param title: title of window
      * @param icon: icon path of window
      * @param is_full: true if this window is fullscreen
+     * @param headless: true if the window is hidden and frames are drawn into an offscreen buffer
      */
     void createWindow(int screen_width,
                       int screen_height,
@@ -72,32 +87,114 @@ public:
                       int resolution_height,
                       const std::string& title,
                       const std::string& icon,
-                      bool is_full);
+                      bool is_full,
+                      bool headless = false);
+
+    /**
+     * Check if frames are drawn into an offscreen buffer without a visible window.
+     * @return bool, true if it's in headless mode
+     */
+    inline bool isHeadless() const {
+        return _offscreen != nullptr;
+    }
+
+    /**
+     * Read back the last frame and hash its pixels. It stalls the pipeline, so it's
+     * only used for checking output in headless mode.
+     * @return uint64_t, FNV-1a hash of pixels
+     */
+    uint64_t hashFrame() const;
 
     /**
      * Clean the scene
      * @param color: background color of scene
      */
     inline void clearScene(const Color& color) {
+        _gpu_timer->begin("clear");
         glClearColor(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f);
         glClear(GL_COLOR_BUFFER_BIT);
+        _gpu_timer->end();
+        _clear_color = color;
     }
 
     /**
-     * Add a rendering command to rendering queue
+     * Use a post process chain. The scene is drawn into an offscreen buffer and passes
+     * of the chain are applied before it's shown.
+     * @param name: name of the chain in resources/config/post_process, or empty to disable post process
+     */
+    void setPostProcess(const std::string& name);
+
+    /**
+     * Add a rendering command to rendering queue. Commands outside of the camera's view
+     * are culled if culling is enabled.
      * @param cmd: rendering command
      */
-    inline void addRendererCommand(RenderingCommand* cmd) {
-        _queue->push(cmd);
+    void addRendererCommand(RenderingCommand* cmd);
+
+    /**
+     * Enable culling or not.
+     * @param en: true if enable culling
+     */
+    inline void enableCulling(const bool& en) {
+        _culling = en;
     }
 
     /**
-     * Set blend factors for blend function.
+     * Check if culling is enabled.
+     * @return bool, true if enable culling
+     */
+    inline bool isCulling() const {
+        return _culling;
+    }
+
+    /**
+     * Set blend factors for blend function. Nothing happens if factors are not changed.
      * @param src: source factor
      * @param dst: destination factor
      */
     inline void setBlendFactor(const unsigned int& src, const unsigned int& dst) {
-        glBlendFunc(src, dst);
+        if (_blend_src != src || _blend_dst != dst) {
+            glBlendFunc(src, dst);
+            _blend_src = src; _blend_dst = dst;
+        }
+    }
+
+    /**
+     * Use a rendering program. Static arguments are uploaded once per frame for each
+     * program. Nothing happens if the program is in use.
+     * @param program: the program to be used
+     */
+    void useProgram(Program* program);
+
+    /**
+     * Bind a texture to texture unit 0. Nothing happens if the texture is bound.
+     * @param texture: texture id
+     */
+    inline void bindTexture(const GLuint& texture) {
+        if (_current_texture != texture) {
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            _current_texture = texture;
+        }
+    }
+
+    /**
+     * Bind a vertices array object. Nothing happens if the object is bound.
+     * @param vao: vertices array object id
+     */
+    inline void bindVertexArray(const GLuint& vao) {
+        if (_current_vao != vao) {
+            glBindVertexArray(vao);
+            _current_vao = vao;
+        }
+    }
+
+    /**
+     * Get the index of current frame.
+     * @return size_t, the index of current frame
+     */
+    inline size_t getFrameIndex() const {
+        return _frame;
     }
 
     /**
@@ -130,6 +227,64 @@ public:
         return _window->getWindowSize();
     }
 
+    /**
+     * Get the sprite batch used for quads drawing.
+     * @return SpriteBatch*, the sprite batch
+     */
+    inline SpriteBatch* getSpriteBatch() {
+        return _batch;
+    }
+
+    /**
+     * Get the instancer used for unit quads drawing.
+     * @return QuadInstancer*, the instancer
+     */
+    inline QuadInstancer* getQuadInstancer() {
+        return _instancer;
+    }
+
+    /**
+     * Get the number of draw calls in last frame.
+     * @return size_t, the number of draw calls
+     */
+    inline size_t getDrawCallsNumber() const {
+        return _draw_calls;
+    }
+
+    /**
+     * Get the number of quads drawn in last frame.
+     * @return size_t, the number of quads
+     */
+    inline size_t getQuadsNumber() const {
+        return _quads;
+    }
+
+    /**
+     * Get the number of commands submitted to rendering queue in last frame.
+     * @return size_t, the number of commands
+     */
+    inline size_t getSubmittedNumber() const {
+        return _submitted;
+    }
+
+    /**
+     * Get the number of commands culled in last frame.
+     * @return size_t, the number of commands
+     */
+    inline size_t getCulledNumber() const {
+        return _culled;
+    }
+
+    /**
+     * Get GPU time of rendering sections in milliseconds: clear, queue, overlay, post process
+     * and swap. In debug mode, time of each rendering command type is included as well.
+     * Results are two frames late.
+     * @return const std::map<std::string, float>&, GPU time of each section
+     */
+    inline const std::map<std::string, float>& getGpuTimes() const {
+        return _gpu_timer->getResults();
+    }
+
 private:
     /**
      * The unique instance if rendering
@@ -151,12 +306,154 @@ private:
      */
     bool _multisampling;
 
+    /**
+     * Batch merging quads rendering commands
+     */
+    SpriteBatch* _batch;
+
+    /**
+     * Instancer merging instanced quads rendering commands
+     */
+    QuadInstancer* _instancer;
+
+    /**
+     * The first command of current batch, whose state is used by the whole batch
+     */
+    RenderingCommand* _batch_command;
+
+    /**
+     * True if current batch is drawn by the instancer
+     */
+    bool _batch_instanced;
+
+    /**
+     * Number of draw calls in last frame
+     */
+    size_t _draw_calls;
+
+    /**
+     * Number of quads drawn in last frame
+     */
+    size_t _quads;
+
+    /**
+     * True if enable culling
+     */
+    bool _culling;
+
+    /**
+     * Number of commands submitted and culled in last frame
+     */
+    size_t _submitted, _culled;
+
+    /**
+     * Number of commands submitted and culled in current frame
+     */
+    size_t _current_submitted, _current_culled;
+
+    /**
+     * Buffer used as screen in headless mode, or nullptr if drawing to the window
+     */
+    RenderTarget* _offscreen;
+
+    /**
+     * Post process chain in use, or nullptr if disabled
+     */
+    PostProcess* _post_process;
+
+    /**
+     * Timer queries measuring GPU time
+     */
+    GpuTimer* _gpu_timer;
+
+    /**
+     * Section that commands being executed belong to
+     */
+    const char* _gpu_section;
+
+    /**
+     * Readable names of rendering command types, used by GPU timing in debug mode
+     */
+    std::map<std::type_index, std::string> _type_names;
+
+    /**
+     * Background color of current frame
+     */
+    Color _clear_color;
+
+    /**
+     * Index of current frame
+     */
+    size_t _frame;
+
+    /**
+     * Program in use
+     */
+    Program* _current_program;
+
+    /**
+     * Texture bound to texture unit 0
+     */
+    GLuint _current_texture;
+
+    /**
+     * Vertices array object bound
+     */
+    GLuint _current_vao;
+
+    /**
+     * Current blend factors
+     */
+    unsigned int _blend_src, _blend_dst;
+
+    /**
+     * Per-frame uniform data shared by all programs, in std140 layout
+     */
+    struct FrameUniforms {
+        glm::mat4 projection;
+    };
+
+    /**
+     * Uniform buffer object holding per-frame uniform data
+     */
+    GLuint _frame_uniforms;
+
+    /**
+     * Upload per-frame uniform data to the uniform buffer object.
+     */
+    void updateFrameUniforms();
+
+    /**
+     * Forget cached OpenGL state. It should be called when state may be
+     * changed outside of the renderer.
+     */
+    void resetStateCache();
+
     /**
      * Execute a rendering command
      * @param cmd: the command to be executed
      */
     void execute(RenderingCommand* cmd);
 
+    /**
+     * Draw quads in current batch or instances.
+     */
+    void flush();
+
+    /**
+     * Start a GPU timing section for executing commands. In debug mode, commands are timed by
+     * their types and added to this section instead.
+     * @param name: name of section
+     */
+    void beginGpuSection(const char* name);
+
+    /**
+     * Get readable name of a rendering command's type.
+     * @param cmd: the rendering command
+     * @return const char*, name of type
+     */
+    const char* getTypeName(RenderingCommand* cmd);
+
     Renderer();
 
     ~Renderer();
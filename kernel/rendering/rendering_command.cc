@@ -0,0 +1,48 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file rendering_command.cc
+
+#include "rendering_command.h"
+
+#include <algorithm>
+
+#include "renderer.h"
+
+namespace ngind::rendering {
+
+void RenderingCommand::prepare() {
+    auto renderer = Renderer::getInstance();
+    renderer->useProgram(_program);
+    renderer->setBlendFactor(_blend_src, _blend_dst);
+}
+
+glm::vec4 RenderingCommand::transformBounds(const glm::vec4& local) const {
+    auto p1 = _model * glm::vec4{local.x, local.y, 0.0f, 1.0f}, p2 = _model * glm::vec4{local.z, local.y, 0.0f, 1.0f},
+         p3 = _model * glm::vec4{local.z, local.w, 0.0f, 1.0f}, p4 = _model * glm::vec4{local.x, local.w, 0.0f, 1.0f};
+
+    return {std::min(std::min(p1.x, p2.x), std::min(p3.x, p4.x)), std::min(std::min(p1.y, p2.y), std::min(p3.y, p4.y)),
+            std::max(std::max(p1.x, p2.x), std::max(p3.x, p4.x)), std::max(std::max(p1.y, p2.y), std::max(p3.y, p4.y))};
+}
+
+} // namespace ngind::rendering
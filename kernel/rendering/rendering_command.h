@@ -38,7 +38,8 @@ namespace ngind::rendering {
  */
 class RenderingCommand : public memory::AutoCollectionObject {
 public:
-    RenderingCommand() : AutoCollectionObject(), _program{}, _z{}, _color(), _model{} {}
+    RenderingCommand() : AutoCollectionObject(), _program{}, _z{}, _color(), _model{}, _texture{},
+    _blend_src{GL_SRC_ALPHA}, _blend_dst{GL_ONE_MINUS_SRC_ALPHA} {}
 
     /**
      * execute the command.
@@ -46,18 +47,18 @@ public:
     virtual void call() = 0;
 
     /**
-     * Set the z order.
+     * Set the z order. It may be negative, e.g. for backgrounds.
      * @param z: the z order
      */
-    inline void setZ(const unsigned int& z) {
+    inline void setZ(const int& z) {
         _z = z;
     }
 
     /**
      * Get the z order.
-     * @return unsigned int, the z order
+     * @return int, the z order
      */
-    inline unsigned int getZ() const {
+    inline int getZ() const {
         return _z;
     }
 
@@ -110,23 +111,74 @@ public:
     }
 
     /**
-     * Prepare before rendering begin, setting OpenGL context.
+     * Set the texture this command uses.
+     * @param texture: texture id, 0 if no texture is used
      */
-    virtual void prepare() {
-        this->getProgram()->use();
-        auto color = this->getColor();
-        this->getProgram()->setFloat4("my_color", color.r / 255.0f, color.g / 255.0f,
-                                     color.b / 255.0f, color.a / 255.0f);
-        this->getProgram()->setMatrix4("projection", Camera::getInstance()->getProjection());
-        this->getProgram()->setMatrix4("model", this->getModel());
+    inline void setTexture(const GLuint& texture) {
+        _texture = texture;
+    }
+
+    /**
+     * Get the texture this command uses.
+     * @return GLuint, texture id
+     */
+    inline GLuint getTexture() const {
+        return _texture;
+    }
+
+    /**
+     * Set blend factors used by this command.
+     * @param src: source factor
+     * @param dst: destination factor
+     */
+    inline void setBlendFactor(const GLenum& src, const GLenum& dst) {
+        _blend_src = src;
+        _blend_dst = dst;
+    }
+
+    /**
+     * Get the source blend factor.
+     * @return GLenum, the source factor
+     */
+    inline GLenum getBlendSource() const {
+        return _blend_src;
+    }
+
+    /**
+     * Get the destination blend factor.
+     * @return GLenum, the destination factor
+     */
+    inline GLenum getBlendDestination() const {
+        return _blend_dst;
+    }
 
-        this->getProgram()->prepare();
+    /**
+     * Get the bounding rectangle in world space, which is used for culling.
+     * @param bounds: the rectangle (left, bottom, right, top)
+     * @return bool, false if bounds are unknown and the command should never be culled
+     */
+    virtual bool getBounds(glm::vec4&) const {
+        return false;
     }
+
+    /**
+     * Prepare before rendering begin, setting OpenGL context. Model matrix and color
+     * are not uploaded here because they are baked into vertices by the renderer.
+     * Redundant state changes are skipped by the renderer.
+     */
+    virtual void prepare();
+protected:
+    /**
+     * Transform a rectangle into world space with the model matrix.
+     * @param local: the rectangle in local space (left, bottom, right, top)
+     * @return glm::vec4, the bounding rectangle in world space
+     */
+    glm::vec4 transformBounds(const glm::vec4& local) const;
 private:
     /**
      * The z order
      */
-    unsigned int _z;
+    int _z;
 
     /**
      * The color for rendering
@@ -142,6 +194,16 @@ private:
      * Render program
      */
     Program* _program;
+
+    /**
+     * Texture id
+     */
+    GLuint _texture;
+
+    /**
+     * Blend factors
+     */
+    GLenum _blend_src, _blend_dst;
 };
 
 } // namespace ngind::rendering
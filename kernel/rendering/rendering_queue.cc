@@ -29,15 +29,34 @@
 
 namespace ngind::rendering {
 
+void RenderingQueue::push(RenderingCommand* command) {
+    auto program = (command->getProgram() == nullptr) ? 0 : command->getProgram()->getID();
+    _keys.push_back(SortKey::pack(command->getZ(), program, command->getTexture(), _queue.size()));
+    _queue.push_back(command);
+}
+
 void RenderingQueue::sort() {
     if (_queue.empty()) {
         return;
     }
 
-    std::sort(_queue.begin(), _queue.end(),
-              [](RenderingCommand* c1, RenderingCommand* c2) -> bool {
-        return c1->getZ() < c2->getZ();
-    });
+    if (_queue.size() > SortKey::MAX_SEQUENCE) {
+        // sequence field overflows, fall back to sorting commands themselves
+        std::stable_sort(_queue.begin(), _queue.end(),
+                         [](RenderingCommand* c1, RenderingCommand* c2) -> bool {
+            return c1->getZ() < c2->getZ();
+        });
+        return;
+    }
+
+    SortKey::sort(_keys, _buffer);
+
+    _sorted.resize(_queue.size());
+    for (size_t i = 0; i < _keys.size(); i++) {
+        _sorted[i] = _queue[SortKey::getSequence(_keys[i])];
+    }
+
+    _queue.swap(_sorted);
 }
 
-} // namespace
\ No newline at end of file
+} // namespace ngind::rendering
@@ -27,13 +27,16 @@
 #define NGIND_RENDERING_QUEUE_H
 
 #include "rendering_command.h"
+#include "sort_key.h"
 
 #include <vector>
+#include <cstdint>
 
 namespace ngind::rendering {
 
 /**
- * A simple queue used to store the rendering commands.
+ * A simple queue used to store the rendering commands. Each command is assigned
+ * a sort key when it's pushed, and commands are sorted by their keys.
  */
 class RenderingQueue {
 public:
@@ -63,18 +66,18 @@ public:
      */
     inline void clear() {
         _queue.clear();
+        _keys.clear();
     }
 
     /**
-     * Push a command pointer into queue
+     * Push a command pointer into queue. Z orders should be in [-8388608, 8388607].
      * @param command: command to be pushed
      */
-    inline void push(RenderingCommand* command) {
-        _queue.push_back(command);
-    }
+    void push(RenderingCommand* command);
 
     /**
-     * Sort all commands by order in z-dim
+     * Sort all commands by order in z-dim, then by program and texture.
+     * Commands with the same key keep their insertion order.
      */
     void sort();
 
@@ -83,6 +86,21 @@ private:
      * Vector buffer to store commands
      */
     std::vector<RenderingCommand*> _queue;
+
+    /**
+     * Sort keys of commands
+     */
+    std::vector<uint64_t> _keys;
+
+    /**
+     * Temporary buffer for radix sort
+     */
+    std::vector<uint64_t> _buffer;
+
+    /**
+     * Temporary buffer for sorted commands
+     */
+    std::vector<RenderingCommand*> _sorted;
 };
 
 } // namespace ngind::rendering
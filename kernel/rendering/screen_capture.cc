@@ -0,0 +1,175 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file screen_capture.cc
+
+
+#include "screen_capture.h"
+
+#include <cstring>
+#include <cstdio>
+#include <memory>
+
+#include "render_target.h"
+#include "SOIL2/SOIL2.h"
+#include "utils/thread_pool.h"
+#include "log/logger_factory.h"
+
+namespace ngind::rendering {
+ScreenCapture* ScreenCapture::_instance = nullptr;
+
+ScreenCapture* ScreenCapture::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new(std::nothrow) ScreenCapture();
+
+        if (_instance == nullptr) {
+            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+            logger->log("Can't create screen capture instance.");
+            logger->flush();
+        }
+    }
+
+    return _instance;
+}
+
+void ScreenCapture::destroyInstance() {
+    if (_instance != nullptr) {
+        delete _instance;
+        _instance = nullptr;
+    }
+}
+
+ScreenCapture::ScreenCapture()
+    : _requests(), _readbacks(), _buffers(), _buffers_number(0),
+    _burst_prefix(), _burst_frames(0), _burst_index(0), _burst_width(0), _burst_height(0) {
+}
+
+ScreenCapture::~ScreenCapture() {
+    for (auto& readback : _readbacks) {
+        glDeleteSync(readback.fence);
+        _buffers.push_back(readback.buffer);
+    }
+    _readbacks.clear();
+
+    if (!_buffers.empty()) {
+        glDeleteBuffers(_buffers.size(), _buffers.data());
+    }
+    _buffers.clear();
+}
+
+void ScreenCapture::capture(const std::string& filename, const size_t& width, const size_t& height) {
+    _requests.push_back(Request{filename, width, height});
+}
+
+void ScreenCapture::startBurst(const std::string& prefix, const size_t& frames,
+                               const size_t& width, const size_t& height) {
+    _burst_prefix = prefix;
+    _burst_frames = frames;
+    _burst_index = 0;
+    _burst_width = width; _burst_height = height;
+}
+
+void ScreenCapture::update() {
+    collect();
+
+    if (_burst_frames > 0) {
+        char index[16];
+        snprintf(index, sizeof(index), "_%05zu.png", _burst_index++);
+        _requests.push_back(Request{_burst_prefix + index, _burst_width, _burst_height});
+        _burst_frames--;
+    }
+
+    if (_requests.empty()) {
+        return;
+    }
+
+    glReadBuffer(RenderTarget::isScreenOffscreen() ? GL_COLOR_ATTACHMENT0 : GL_BACK);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    while (!_requests.empty()) {
+        if (_buffers.empty()) {
+            if (_buffers_number >= MAX_READBACKS_NUMBER) {
+                break;
+            }
+
+            GLuint buffer = 0;
+            glGenBuffers(1, &buffer);
+            _buffers.push_back(buffer);
+            _buffers_number++;
+        }
+
+        auto request = _requests.front();
+        _requests.pop_front();
+
+        GLuint buffer = _buffers.back();
+        _buffers.pop_back();
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, request.width * request.height * 4, nullptr, GL_STREAM_READ);
+        glReadPixels(0, 0, request.width, request.height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        auto fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        _readbacks.push_back(Readback{buffer, fence, request});
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void ScreenCapture::collect() {
+    while (!_readbacks.empty()) {
+        auto& readback = _readbacks.front();
+        auto status = glClientWaitSync(readback.fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            break;
+        }
+
+        glDeleteSync(readback.fence);
+        auto width = readback.request.width, height = readback.request.height;
+        size_t row = width * 4;
+        std::shared_ptr<unsigned char[]> pixels{new unsigned char[row * height]};
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+        auto data = static_cast<const unsigned char*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, row * height, GL_MAP_READ_BIT));
+        if (data != nullptr) {
+            // rows are bottom-up in OpenGL, so they are flipped while copying out of the buffer
+            for (size_t i = 0; i < height; i++) {
+                std::memcpy(pixels.get() + (height - i - 1) * row, data + i * row, row);
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+            auto filename = readback.request.filename;
+            utils::ThreadPool::getInstance()->post([filename, width, height, pixels]() {
+                SOIL_save_image(filename.c_str(), SOIL_SAVE_TYPE_PNG, width, height, SOIL_LOAD_RGBA, pixels.get());
+            });
+        }
+        else {
+            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+            logger->log("Can't read back " + readback.request.filename + ".");
+            logger->flush();
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        _buffers.push_back(readback.buffer);
+        _readbacks.pop_front();
+    }
+}
+
+} // namespace ngind::rendering
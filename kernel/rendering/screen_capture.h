@@ -0,0 +1,187 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file screen_capture.h
+
+
+#ifndef NGIND_SCREEN_CAPTURE_H
+#define NGIND_SCREEN_CAPTURE_H
+
+#include <string>
+#include <deque>
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace ngind::rendering {
+
+/**
+ * Screenshots without stalling the pipeline. Frames are read into pixel buffer objects
+ * guarded by fences, copied out a frame or two later when GPU has finished, and encoded
+ * to PNG on worker threads.
+ */
+class ScreenCapture {
+public:
+    /**
+     * Maximum number of readbacks in flight. Requests wait for free buffers if it's reached.
+     */
+    constexpr static size_t MAX_READBACKS_NUMBER = 4;
+
+    /**
+     * Get the instance of screen capture.
+     * @return ScreenCapture*, the instance
+     */
+    static ScreenCapture* getInstance();
+
+    /**
+     * Destroy the instance of screen capture. Captures not read back are dropped.
+     */
+    static void destroyInstance();
+
+    /**
+     * Capture current frame when it has been drawn.
+     * @param filename: the saved file's name
+     * @param width: width of picture
+     * @param height: height of picture
+     */
+    void capture(const std::string& filename, const size_t& width, const size_t& height);
+
+    /**
+     * Capture following frames, saved as prefix_00000.png, prefix_00001.png...
+     * @param prefix: prefix of saved files' names
+     * @param frames: number of frames
+     * @param width: width of pictures
+     * @param height: height of pictures
+     */
+    void startBurst(const std::string& prefix, const size_t& frames, const size_t& width, const size_t& height);
+
+    /**
+     * Stop capturing following frames.
+     */
+    inline void stopBurst() {
+        _burst_frames = 0;
+    }
+
+    /**
+     * Read back the frame if requested, and hand finished readbacks to workers. It should be
+     * called after the frame is drawn and before buffers are swapped.
+     */
+    void update();
+
+    /**
+     * Get the number of captures not handed to workers yet.
+     * @return size_t, the number of captures
+     */
+    inline size_t getPendingNumber() const {
+        return _requests.size() + _readbacks.size();
+    }
+
+    ScreenCapture(const ScreenCapture&) = delete;
+    ScreenCapture& operator= (const ScreenCapture&) = delete;
+private:
+    ScreenCapture();
+    ~ScreenCapture();
+
+    /**
+     * The instance of screen capture
+     */
+    static ScreenCapture* _instance;
+
+    /**
+     * Capture waiting for readback.
+     */
+    struct Request {
+        std::string filename;
+        size_t width;
+        size_t height;
+    };
+
+    /**
+     * Readback in flight.
+     */
+    struct Readback {
+        /**
+         * Pixel buffer object receiving the frame
+         */
+        GLuint buffer;
+
+        /**
+         * Fence signaled when the frame is copied into buffer
+         */
+        GLsync fence;
+
+        /**
+         * The capture request
+         */
+        Request request;
+    };
+
+    /**
+     * Captures waiting for readback
+     */
+    std::deque<Request> _requests;
+
+    /**
+     * Readbacks in flight, in order of frames
+     */
+    std::deque<Readback> _readbacks;
+
+    /**
+     * Pixel buffer objects not in use
+     */
+    std::vector<GLuint> _buffers;
+
+    /**
+     * Number of buffers created
+     */
+    size_t _buffers_number;
+
+    /**
+     * Prefix of burst capture files
+     */
+    std::string _burst_prefix;
+
+    /**
+     * Number of frames left in burst capture
+     */
+    size_t _burst_frames;
+
+    /**
+     * Index of next frame in burst capture
+     */
+    size_t _burst_index;
+
+    /**
+     * Size of burst capture pictures
+     */
+    size_t _burst_width, _burst_height;
+
+    /**
+     * Copy finished readbacks out of buffers and post encoding tasks.
+     */
+    void collect();
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_SCREEN_CAPTURE_H
@@ -0,0 +1,77 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file sort_key.cc
+
+#include "sort_key.h"
+
+#include <algorithm>
+
+namespace ngind::rendering {
+
+uint64_t SortKey::pack(const int& z, const unsigned int& program, const unsigned int& texture, const uint64_t& sequence) {
+    constexpr uint64_t program_mask = (1ull << PROGRAM_BITS) - 1, texture_mask = (1ull << TEXTURE_BITS) - 1;
+
+    // bias signed z orders so negative ones are sorted before positive ones.
+    auto biased = static_cast<uint64_t>(std::clamp<int64_t>(z, MIN_Z, MAX_Z) - MIN_Z);
+    return (biased << (PROGRAM_BITS + TEXTURE_BITS + SEQUENCE_BITS)) |
+           ((program & program_mask) << (TEXTURE_BITS + SEQUENCE_BITS)) |
+           ((texture & texture_mask) << SEQUENCE_BITS) | sequence;
+}
+
+void SortKey::sort(std::vector<uint64_t>& keys, std::vector<uint64_t>& buffer) {
+    if (keys.empty()) {
+        return;
+    }
+
+    constexpr size_t passes = sizeof(uint64_t), buckets = 256;
+    size_t count[passes][buckets] = {};
+    for (const auto& key : keys) {
+        for (size_t p = 0; p < passes; p++) {
+            count[p][(key >> (p * 8)) & 0xFF]++;
+        }
+    }
+
+    buffer.resize(keys.size());
+    for (size_t p = 0; p < passes; p++) {
+        // all keys share the same digit, nothing to do in this pass
+        if (count[p][(keys[0] >> (p * 8)) & 0xFF] == keys.size()) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (auto& c : count[p]) {
+            auto temp = c;
+            c = offset;
+            offset += temp;
+        }
+
+        for (const auto& key : keys) {
+            buffer[count[p][(key >> (p * 8)) & 0xFF]++] = key;
+        }
+
+        keys.swap(buffer);
+    }
+}
+
+} // namespace ngind::rendering
@@ -0,0 +1,84 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file sort_key.h
+
+#ifndef NGIND_SORT_KEY_H
+#define NGIND_SORT_KEY_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ngind::rendering {
+
+/**
+ * 64-bit sort key of rendering commands packed by z order, program, texture and insertion
+ * sequence, from high bits to low bits. Sorting keys gives a deterministic order with few state changes.
+ */
+class SortKey {
+public:
+    /**
+     * Bits of each field in sort key, from high to low.
+     */
+    constexpr static uint64_t Z_BITS = 24, PROGRAM_BITS = 8, TEXTURE_BITS = 12, SEQUENCE_BITS = 20;
+
+    /**
+     * Range of z orders kept apart in sort keys: [MIN_Z, MAX_Z]. Z orders out of it are clamped.
+     */
+    constexpr static int64_t MIN_Z = -(1ll << (Z_BITS - 1)), MAX_Z = (1ll << (Z_BITS - 1)) - 1;
+
+    /**
+     * Max number of keys sorted with their sequences
+     */
+    constexpr static uint64_t MAX_SEQUENCE = 1ull << SEQUENCE_BITS;
+
+    /**
+     * Pack a sort key.
+     * @param z: z order, in [MIN_Z, MAX_Z]
+     * @param program: program id
+     * @param texture: texture id
+     * @param sequence: insertion sequence, less than MAX_SEQUENCE
+     * @return uint64_t, the key
+     */
+    static uint64_t pack(const int& z, const unsigned int& program, const unsigned int& texture, const uint64_t& sequence);
+
+    /**
+     * Get insertion sequence of a key.
+     * @param key: the key
+     * @return uint64_t, the sequence
+     */
+    inline static uint64_t getSequence(const uint64_t& key) {
+        return key & (MAX_SEQUENCE - 1);
+    }
+
+    /**
+     * Sort keys by LSD radix sort.
+     * @param keys: keys to be sorted
+     * @param buffer: temporary buffer, reused between calls
+     */
+    static void sort(std::vector<uint64_t>& keys, std::vector<uint64_t>& buffer);
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_SORT_KEY_H
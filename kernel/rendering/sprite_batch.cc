@@ -0,0 +1,100 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file sprite_batch.cc
+
+#include "sprite_batch.h"
+
+#include <cstddef>
+
+#include "renderer.h"
+
+namespace ngind::rendering {
+
+SpriteBatch::SpriteBatch() : _vao(0), _vbo(0), _ebo(0), _vertices(), _draw_calls(0), _quads(0) {
+    _vertices.reserve(MAX_QUADS_NUMBER * 4);
+
+    glGenVertexArrays(1, &_vao);
+    glGenBuffers(1, &_vbo);
+    glGenBuffers(1, &_ebo);
+
+    glBindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * MAX_QUADS_NUMBER * 4, nullptr, GL_STREAM_DRAW);
+
+    std::vector<GLuint> indices(MAX_QUADS_NUMBER * 6);
+    for (GLuint i = 0; i < MAX_QUADS_NUMBER; i++) {
+        indices[i * 6] = i * 4; indices[i * 6 + 1] = i * 4 + 1; indices[i * 6 + 2] = i * 4 + 3;
+        indices[i * 6 + 3] = i * 4 + 1; indices[i * 6 + 4] = i * 4 + 2; indices[i * 6 + 5] = i * 4 + 3;
+    }
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * indices.size(), indices.data(), GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(offsetof(Vertex, x)));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(offsetof(Vertex, r)));
+    glEnableVertexAttribArray(1);
+
+    glBindVertexArray(0);
+}
+
+SpriteBatch::~SpriteBatch() {
+    glDeleteVertexArrays(1, &_vao);
+    glDeleteBuffers(1, &_vbo);
+    glDeleteBuffers(1, &_ebo);
+}
+
+void SpriteBatch::push(const Quad* quad, const glm::mat4& model, const Color& color) {
+    const GLfloat* data = quad->getVertices();
+    for (size_t i = 0; i < quad->getQuadsNumber(); i++) {
+        if (_vertices.size() == MAX_QUADS_NUMBER * 4) {
+            flush();
+        }
+
+        for (size_t j = 0; j < 4; j++, data += 4) {
+            auto pos = model * glm::vec4{data[0], data[1], 0.0f, 1.0f};
+            _vertices.push_back(Vertex{pos.x, pos.y, data[2], data[3], color.r, color.g, color.b, color.a});
+        }
+    }
+}
+
+void SpriteBatch::flush() {
+    if (_vertices.empty()) {
+        return;
+    }
+
+    Renderer::getInstance()->bindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * MAX_QUADS_NUMBER * 4, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Vertex) * _vertices.size(), _vertices.data());
+
+    auto number = _vertices.size() / 4;
+    glDrawElements(GL_TRIANGLES, number * 6, GL_UNSIGNED_INT, nullptr);
+
+    _draw_calls++;
+    _quads += number;
+    _vertices.clear();
+}
+
+} // namespace ngind::rendering
@@ -0,0 +1,156 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file sprite_batch.h
+
+#ifndef NGIND_SPRITE_BATCH_H
+#define NGIND_SPRITE_BATCH_H
+
+#include "GL/glew.h"
+
+#include <vector>
+
+#include "quad.h"
+#include "color.h"
+#include "glm/glm.hpp"
+
+namespace ngind::rendering {
+
+/**
+ * Dynamic batcher for quads. Quads sharing the same program, texture and blend state
+ * are transformed into world space on CPU, written into a streaming vertex buffer and
+ * submitted with a single draw call.
+ */
+class SpriteBatch {
+public:
+    /**
+     * Max number of quads in one draw call.
+     */
+    constexpr static size_t MAX_QUADS_NUMBER = 2048;
+
+    SpriteBatch();
+    ~SpriteBatch();
+
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator= (const SpriteBatch&) = delete;
+
+    /**
+     * Append quads to this batch. Model matrix and color are baked into vertices.
+     * If the batch is full, it will be flushed automatically.
+     * @param quad: the quad data
+     * @param model: the model matrix
+     * @param color: the color of quad
+     */
+    void push(const Quad* quad, const glm::mat4& model, const Color& color);
+
+    /**
+     * Draw all quads in this batch with current OpenGL state and clear the batch.
+     */
+    void flush();
+
+    /**
+     * Check if there is nothing to be drawn.
+     * @return bool, true if batch is empty
+     */
+    inline bool isEmpty() const {
+        return _vertices.empty();
+    }
+
+    /**
+     * Get the number of draw calls since last reset.
+     * @return size_t, the number of draw calls
+     */
+    inline size_t getDrawCallsNumber() const {
+        return _draw_calls;
+    }
+
+    /**
+     * Get the number of quads drawn since last reset.
+     * @return size_t, the number of quads
+     */
+    inline size_t getQuadsNumber() const {
+        return _quads;
+    }
+
+    /**
+     * Reset statistics data.
+     */
+    inline void resetStatistics() {
+        _draw_calls = 0;
+        _quads = 0;
+    }
+private:
+    /**
+     * Vertex layout in the streaming buffer.
+     */
+    struct Vertex {
+        /**
+         * Position in world space.
+         */
+        GLfloat x, y;
+
+        /**
+         * Texture coordinate.
+         */
+        GLfloat u, v;
+
+        /**
+         * Color of vertex.
+         */
+        GLubyte r, g, b, a;
+    };
+
+    /**
+     * The vertices array object
+     */
+    GLuint _vao;
+
+    /**
+     * The streaming vertices buffer object
+     */
+    GLuint _vbo;
+
+    /**
+     * The element buffer object
+     */
+    GLuint _ebo;
+
+    /**
+     * Vertices waiting for drawing
+     */
+    std::vector<Vertex> _vertices;
+
+    /**
+     * Number of draw calls
+     */
+    size_t _draw_calls;
+
+    /**
+     * Number of quads drawn
+     */
+    size_t _quads;
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_SPRITE_BATCH_H
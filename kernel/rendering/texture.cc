@@ -23,6 +23,11 @@
 
 #include "texture.h"
 
+#include <cstdlib>
+#include <cstring>
+
+#include "texture_loader.h"
+#include "block_compression.h"
 #include "SOIL2/SOIL2.h"
 #include "filesystem/file_input_stream.h"
 #include "filesystem/zip_input_stream.h"
@@ -31,7 +36,14 @@
 
 namespace ngind::rendering {
 
-Texture::Texture(const std::string& filename, const TextureColorMode& mode) : _texture_id{}, _mode{mode}, _size{} {
+Texture::Texture(const std::string& filename, const TextureColorMode& mode) : Texture(mode) {
+    auto image = decode(filename, mode);
+    upload(image);
+    freeImage(image);
+}
+
+Texture::Texture(const TextureColorMode& mode)
+    : _texture_id{}, _mode{mode}, _size{1.0f, 1.0f}, _page{nullptr}, _rect{}, _ready{false} {
     glGenTextures(1, &_texture_id);
     glBindTexture(GL_TEXTURE_2D, _texture_id);
 
@@ -40,52 +52,137 @@ Texture::Texture(const std::string& filename, const TextureColorMode& mode) : _t
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    int width = 0, height = 0;
-    unsigned char* img = nullptr;
-    int channel = 0, gl_color_mode = 0;
+    const unsigned char placeholder[4] = {0, 0, 0, 0};
+    glTexImage2D(GL_TEXTURE_2D, 0, mode, 1, 1, 0, mode, GL_UNSIGNED_BYTE, placeholder);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+Texture::Texture(const Texture* page, const glm::vec4& rect)
+    : _texture_id{page->_texture_id}, _mode{page->_mode}, _size{rect.z, rect.w}, _page{page}, _rect{rect}, _ready{false} {
+}
+
+Texture::~Texture() {
+    if (_page == nullptr) {
+        // textures may outlive the loader, which has dropped all requests by then
+        if (!_ready && TextureLoader::hasInstance()) {
+            TextureLoader::getInstance()->cancel(this);
+        }
+
+        glDeleteTextures(1, &_texture_id);
+    }
+}
+
+void Texture::upload(const ImageData& image) {
+    _ready = true;
+    if (image.pixels == nullptr) {
+        return;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, _texture_id);
+    if (image.format != 0) {
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, image.format, image.width, image.height, 0,
+                               image.size, image.pixels);
+    }
+    else {
+        glTexImage2D(GL_TEXTURE_2D, 0, _mode, image.width,
+                     image.height, 0, _mode, GL_UNSIGNED_BYTE, image.pixels);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    _size = glm::vec2{image.width, image.height};
+}
+
+void Texture::uploadFromBuffer(const ImageData& image) {
+    glBindTexture(GL_TEXTURE_2D, _texture_id);
+    if (image.format != 0) {
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, image.format, image.width, image.height, 0, image.size, nullptr);
+    }
+    else if (_ready && _size == glm::vec2{image.width, image.height}) {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, image.width, image.height, _mode, GL_UNSIGNED_BYTE, nullptr);
+    }
+    else {
+        // storage of placeholder is too small, so it's reallocated and filled from the buffer
+        glTexImage2D(GL_TEXTURE_2D, 0, _mode, image.width, image.height, 0, _mode, GL_UNSIGNED_BYTE, nullptr);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    _size = glm::vec2{image.width, image.height};
+    _ready = true;
+}
+
+ImageData Texture::decode(const std::string& filename, const TextureColorMode& mode) {
+    ImageData image{0, 0, nullptr, 0, 0};
+    int channel = 0;
     if (mode == TextureColorMode::MODE_RGB) {
-        channel = SOIL_LOAD_RGB; gl_color_mode = GL_RGB;
+        channel = SOIL_LOAD_RGB;
     }
     else if (mode == TextureColorMode::MODE_RGBA) {
-        channel = SOIL_LOAD_RGBA; gl_color_mode = GL_RGBA;
+        channel = SOIL_LOAD_RGBA;
     }
     else {
         auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
         logger->log("Unsupported image format.");
         logger->flush();
+        return image;
     }
 
-    if constexpr (CURRENT_MODE == MODE_RELEASE) {
+    std::string content;
+    auto pos = filename.find_last_of('.');
+    bool compressed = filename.substr(pos + 1) == BlockCompression::EXTENSION;
+    if (CURRENT_MODE == MODE_RELEASE && !compressed) {
         std::string temp = filename;
-        int pos = filename.find_last_of('.');
         temp.replace(pos + 1, 1, "c");
 
         auto fp = new filesystem::ZipInputStream(new filesystem::FileInputStream(temp));
-        std::string content = fp->readAllCharacters();
+        content = fp->readAllCharacters();
         fp->close();
-        img = SOIL_load_image_from_memory(reinterpret_cast<const unsigned char *const>(content.c_str()),
-                                          content.length(), &width, &height, nullptr, channel);
     }
     else {
         auto fp = new filesystem::FileInputStream(filename);
-        std::string content = fp->readAllCharacters();
+        content = fp->readAllCharacters();
         fp->close();
-        img = SOIL_load_image_from_memory(reinterpret_cast<const unsigned char *const>(content.c_str()),
-                                          content.length(), &width, &height, nullptr, channel);
     }
 
-    glTexImage2D(GL_TEXTURE_2D, 0, gl_color_mode, width,
-                 height, 0, gl_color_mode, GL_UNSIGNED_BYTE, img);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (compressed) {
+        decodeBlocks(content, channel, image);
+        return image;
+    }
 
-    _size = glm::vec2{width, height};
-    SOIL_free_image_data(img);
+    image.pixels = SOIL_load_image_from_memory(reinterpret_cast<const unsigned char *const>(content.c_str()),
+                                               content.length(), &image.width, &image.height, nullptr, channel);
+    image.size = static_cast<size_t>(image.width) * image.height * channel;
+    return image;
+}
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+void Texture::decodeBlocks(const std::string& content, const int& channels, ImageData& image) {
+    BlockCompression::Header header{};
+    if (!BlockCompression::readHeader(content, header)) {
+        return;
+    }
+
+    auto blocks = reinterpret_cast<const unsigned char*>(content.data()) + BlockCompression::HEADER_SIZE;
+    image.width = header.width; image.height = header.height;
+
+    // SOIL releases pixels by free, so buffers here are allocated by malloc as well
+    if (GLEW_EXT_texture_compression_s3tc) {
+        image.size = header.size;
+        image.format = (header.format == BlockCompression::FORMAT_DXT5) ?
+                GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        image.pixels = static_cast<unsigned char*>(std::malloc(image.size));
+        std::memcpy(image.pixels, blocks, image.size);
+    }
+    else {
+        image.size = static_cast<size_t>(header.width) * header.height * channels;
+        image.pixels = static_cast<unsigned char*>(std::malloc(image.size));
+        BlockCompression::decode(blocks, header, image.pixels, channels);
+    }
 }
 
-Texture::~Texture() {
-    glDeleteTextures(1, &_texture_id);
+void Texture::freeImage(ImageData& image) {
+    if (image.pixels != nullptr) {
+        SOIL_free_image_data(image.pixels);
+        image.pixels = nullptr;
+    }
 }
 
 } // namespace ngind::rendering
\ No newline at end of file
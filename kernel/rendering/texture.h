@@ -39,6 +39,36 @@ enum TextureColorMode {
     MODE_RGBA = GL_RGBA
 };
 
+/**
+ * Decoded pixels of an image.
+ */
+struct ImageData {
+    /**
+     * Width of image
+     */
+    int width;
+
+    /**
+     * Height of image
+     */
+    int height;
+
+    /**
+     * Pixels data or compressed blocks, or nullptr if decoding failed
+     */
+    unsigned char* pixels;
+
+    /**
+     * Size of data in bytes
+     */
+    size_t size;
+
+    /**
+     * Compressed internal format, or 0 if pixels are not compressed
+     */
+    GLenum format;
+};
+
 /**
  * Texture container used for rendering. It only supports JPEG and PNG formats now.
  */
@@ -50,6 +80,21 @@ public:
      */
     Texture(const std::string& filename, const TextureColorMode& mode);
 
+    /**
+     * Create a texture holding a transparent placeholder pixel. Real pixels are
+     * uploaded later by upload, and the texture id doesn't change.
+     * @param mode: color mode of picture
+     */
+    explicit Texture(const TextureColorMode& mode);
+
+    /**
+     * Create a texture referring to a sub-rectangle of another texture, e.g. an image
+     * in atlas page. The page must outlive this texture.
+     * @param page: the texture containing this one
+     * @param rect: sub-rectangle in pixels: (x, y, width, height)
+     */
+    Texture(const Texture* page, const glm::vec4& rect);
+
     ~Texture();
 
     Texture(const Texture&) = delete;
@@ -95,7 +140,65 @@ public:
         return _mode;
     }
 
+    /**
+     * Map texture coordinates of this texture to coordinates of the GL texture it lives in.
+     * It does nothing unless this texture is a sub-rectangle of another one.
+     * @param uv: texture coordinates in [0, 1]
+     * @return glm::vec2, texture coordinates in the GL texture
+     */
+    inline glm::vec2 mapCoordinate(const glm::vec2& uv) const {
+        if (_page == nullptr) {
+            return uv;
+        }
+
+        return (glm::vec2{_rect.x, _rect.y} + uv * glm::vec2{_rect.z, _rect.w}) / _page->getSize();
+    }
+
+    /**
+     * Check if pixels have been uploaded. A texture not ready shows its placeholder.
+     * @return bool, true if it's ready
+     */
+    inline bool isReady() const {
+        return (_page == nullptr) ? _ready : _page->isReady();
+    }
+
+    /**
+     * Upload decoded pixels and replace the placeholder. It must be called on the main thread.
+     * @param image: the decoded image
+     */
+    void upload(const ImageData& image);
+
+    /**
+     * Upload pixels from the pixel buffer object bound to GL_PIXEL_UNPACK_BUFFER, starting
+     * at offset 0, and replace the placeholder. It must be called on the main thread.
+     * @param image: the decoded image, whose pixels are ignored
+     */
+    void uploadFromBuffer(const ImageData& image);
+
+    /**
+     * Read and decode an image file. It doesn't touch OpenGL, so it's safe to call on worker threads.
+     * Block compressed files are kept compressed if GPU supports S3TC, or decompressed otherwise.
+     * @param filename: picture path
+     * @param mode: color mode of picture
+     * @return ImageData, the decoded image. Pixels should be released by freeImage
+     */
+    static ImageData decode(const std::string& filename, const TextureColorMode& mode);
+
+    /**
+     * Release pixels of a decoded image.
+     * @param image: the decoded image
+     */
+    static void freeImage(ImageData& image);
+
 private:
+    /**
+     * Read blocks from a compressed texture container.
+     * @param content: the container
+     * @param channels: 3 for RGB, 4 for RGBA, used if blocks must be decompressed
+     * @param image: the image read
+     */
+    static void decodeBlocks(const std::string& content, const int& channels, ImageData& image);
+
     /**
      * Texture id
      */
@@ -110,6 +213,21 @@ private:
      * Color mode of texture
      */
     TextureColorMode _mode;
+
+    /**
+     * The texture containing this one, or nullptr if the GL texture is owned by this texture
+     */
+    const Texture* _page;
+
+    /**
+     * Sub-rectangle in the page in pixels: (x, y, width, height)
+     */
+    glm::vec4 _rect;
+
+    /**
+     * True if pixels have been uploaded
+     */
+    bool _ready;
 };
 
 } // namespace ngind::rendering
@@ -0,0 +1,129 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file texture_loader.cc
+
+
+#include "texture_loader.h"
+
+#include "utils/thread_pool.h"
+#include "log/logger_factory.h"
+
+namespace ngind::rendering {
+TextureLoader* TextureLoader::_instance = nullptr;
+
+TextureLoader* TextureLoader::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new(std::nothrow) TextureLoader();
+
+        if (_instance == nullptr) {
+            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+            logger->log("Can't create texture loader instance.");
+            logger->flush();
+        }
+    }
+
+    return _instance;
+}
+
+void TextureLoader::destroyInstance() {
+    if (_instance != nullptr) {
+        delete _instance;
+        _instance = nullptr;
+    }
+}
+
+bool TextureLoader::hasInstance() {
+    return _instance != nullptr;
+}
+
+TextureLoader::TextureLoader() : _next_request(0), _requests(), _decoded(), _mutex(), _uploads() {
+}
+
+TextureLoader::~TextureLoader() {
+    while (!_decoded.empty()) {
+        Texture::freeImage(_decoded.front().image);
+        _decoded.pop();
+    }
+
+    _requests.clear();
+}
+
+void TextureLoader::load(Texture* texture, const std::string& filename, const TextureColorMode& mode) {
+    auto request = _next_request++;
+    _requests[request] = texture;
+
+    utils::ThreadPool::getInstance()->post([this, request, filename, mode]() {
+        auto image = Texture::decode(filename, mode);
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        _decoded.push(DecodedImage{request, image});
+    });
+}
+
+void TextureLoader::cancel(Texture* texture) {
+    for (auto it = _requests.begin(); it != _requests.end();) {
+        if (it->second == texture) {
+            it = _requests.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    _uploads.cancel(texture);
+}
+
+void TextureLoader::update() {
+    while (true) {
+        DecodedImage decoded{};
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (_decoded.empty()) {
+                break;
+            }
+
+            decoded = _decoded.front();
+            _decoded.pop();
+        }
+
+        auto it = _requests.find(decoded.request);
+        if (it == _requests.end()) {
+            Texture::freeImage(decoded.image);
+            continue;
+        }
+
+        if (decoded.image.pixels == nullptr) {
+            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+            logger->log("Can't decode texture.");
+            logger->flush();
+        }
+
+        _uploads.push(it->second, decoded.image);
+        _requests.erase(it);
+    }
+
+    _uploads.update();
+}
+
+} // namespace ngind::rendering
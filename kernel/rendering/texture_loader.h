@@ -0,0 +1,169 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file texture_loader.h
+
+
+#ifndef NGIND_TEXTURE_LOADER_H
+#define NGIND_TEXTURE_LOADER_H
+
+#include <string>
+#include <queue>
+#include <mutex>
+#include <unordered_map>
+
+#include "texture.h"
+#include "texture_upload_queue.h"
+
+namespace ngind::rendering {
+
+/**
+ * Loader decoding textures on worker threads. Decoded pixels are streamed to textures
+ * on the main thread by update, and textures show their placeholders until then.
+ */
+class TextureLoader {
+public:
+    /**
+     * Get the instance of texture loader.
+     * @return TextureLoader*, the instance
+     */
+    static TextureLoader* getInstance();
+
+    /**
+     * Destroy the instance of texture loader. The thread pool should be destroyed before it.
+     */
+    static void destroyInstance();
+
+    /**
+     * Check whether the texture loader exists, without creating it.
+     * @return bool, true if the instance is alive
+     */
+    static bool hasInstance();
+
+    /**
+     * Decode an image file on a worker thread and upload it to the texture later.
+     * @param texture: the texture holding a placeholder
+     * @param filename: picture path
+     * @param mode: color mode of picture
+     */
+    void load(Texture* texture, const std::string& filename, const TextureColorMode& mode);
+
+    /**
+     * Forget requests of a texture. Pixels decoded for it would be discarded.
+     * @param texture: the texture
+     */
+    void cancel(Texture* texture);
+
+    /**
+     * Move decoded images into upload queue and stream them to textures. It must be called
+     * on the main thread.
+     */
+    void update();
+
+    /**
+     * Set bytes uploaded in each frame.
+     * @param budget: bytes per frame, or 0 for default budget
+     */
+    inline void setUploadBudget(const size_t& budget) {
+        _uploads.setBudget(budget);
+    }
+
+    /**
+     * Get bytes uploaded in each frame.
+     * @return size_t, bytes per frame
+     */
+    inline size_t getUploadBudget() const {
+        return _uploads.getBudget();
+    }
+
+    /**
+     * Get bytes decoded but not uploaded yet.
+     * @return size_t, bytes in upload queue
+     */
+    inline size_t getUploadBacklog() const {
+        return _uploads.getBacklog();
+    }
+
+    /**
+     * Get the number of textures still being decoded.
+     * @return size_t, the number of textures
+     */
+    inline size_t getPendingNumber() const {
+        return _requests.size();
+    }
+
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator= (const TextureLoader&) = delete;
+private:
+    TextureLoader();
+    ~TextureLoader();
+
+    /**
+     * The instance of texture loader
+     */
+    static TextureLoader* _instance;
+
+    /**
+     * Image decoded by workers.
+     */
+    struct DecodedImage {
+        /**
+         * Id of request
+         */
+        size_t request;
+
+        /**
+         * Decoded pixels
+         */
+        ImageData image;
+    };
+
+    /**
+     * Id of next request
+     */
+    size_t _next_request;
+
+    /**
+     * Textures waiting for pixels, indexed by request id. Only accessed on the main thread.
+     */
+    std::unordered_map<size_t, Texture*> _requests;
+
+    /**
+     * Images decoded but not uploaded
+     */
+    std::queue<DecodedImage> _decoded;
+
+    /**
+     * Mutex protecting decoded images queue
+     */
+    std::mutex _mutex;
+
+    /**
+     * Queue streaming decoded images to textures
+     */
+    TextureUploadQueue _uploads;
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_TEXTURE_LOADER_H
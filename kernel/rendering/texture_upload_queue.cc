@@ -0,0 +1,122 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file texture_upload_queue.cc
+
+
+#include "texture_upload_queue.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ngind::rendering {
+
+TextureUploadQueue::TextureUploadQueue() : _uploads(), _buffer(0), _budget(DEFAULT_BUDGET) {
+}
+
+TextureUploadQueue::~TextureUploadQueue() {
+    for (auto& upload : _uploads) {
+        Texture::freeImage(upload.image);
+    }
+    _uploads.clear();
+
+    if (_buffer != 0) {
+        glDeleteBuffers(1, &_buffer);
+        _buffer = 0;
+    }
+}
+
+void TextureUploadQueue::push(Texture* texture, const ImageData& image) {
+    _uploads.push_back(Upload{texture, image, image.size, 0});
+}
+
+void TextureUploadQueue::cancel(Texture* texture) {
+    for (auto it = _uploads.begin(); it != _uploads.end();) {
+        if (it->texture == texture) {
+            Texture::freeImage(it->image);
+            it = _uploads.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void TextureUploadQueue::update() {
+    if (_uploads.empty()) {
+        return;
+    }
+
+    if (_buffer == 0) {
+        glGenBuffers(1, &_buffer);
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _buffer);
+    size_t budget = _budget;
+    while (!_uploads.empty() && budget > 0) {
+        auto& upload = _uploads.front();
+        if (upload.image.pixels == nullptr) {
+            upload.texture->upload(upload.image);
+            _uploads.pop_front();
+            continue;
+        }
+
+        if (upload.staged == 0) {
+            // orphan storage read by previous uploads
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, upload.size, nullptr, GL_STREAM_DRAW);
+        }
+
+        size_t length = std::min(budget, upload.size - upload.staged);
+        auto p = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, upload.staged, length,
+                                  GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (p != nullptr) {
+            std::memcpy(p, upload.image.pixels + upload.staged, length);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        else {
+            glBufferSubData(GL_PIXEL_UNPACK_BUFFER, upload.staged, length, upload.image.pixels + upload.staged);
+        }
+
+        upload.staged += length;
+        budget -= length;
+
+        if (upload.staged == upload.size) {
+            upload.texture->uploadFromBuffer(upload.image);
+            Texture::freeImage(upload.image);
+            _uploads.pop_front();
+        }
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+size_t TextureUploadQueue::getBacklog() const {
+    size_t backlog = 0;
+    for (const auto& upload : _uploads) {
+        backlog += upload.size - upload.staged;
+    }
+
+    return backlog;
+}
+
+} // namespace ngind::rendering
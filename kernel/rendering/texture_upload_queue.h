@@ -0,0 +1,141 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file texture_upload_queue.h
+
+
+#ifndef NGIND_TEXTURE_UPLOAD_QUEUE_H
+#define NGIND_TEXTURE_UPLOAD_QUEUE_H
+
+#include <deque>
+
+#include "GL/glew.h"
+
+#include "texture.h"
+
+namespace ngind::rendering {
+
+/**
+ * Queue streaming decoded pixels to textures through a pixel buffer object. At most
+ * a given number of bytes are staged in each frame, so large images are spread across
+ * several frames. Once all pixels of an image are staged, the texture is filled by
+ * glTexSubImage2D from the buffer, which doesn't block the main thread.
+ */
+class TextureUploadQueue {
+public:
+    /**
+     * Default bytes staged in each frame
+     */
+    constexpr static size_t DEFAULT_BUDGET = 4 * 1024 * 1024;
+
+    TextureUploadQueue();
+    ~TextureUploadQueue();
+
+    TextureUploadQueue(const TextureUploadQueue&) = delete;
+    TextureUploadQueue& operator= (const TextureUploadQueue&) = delete;
+
+    /**
+     * Push an image into the queue. The queue takes over its pixels.
+     * @param texture: the texture receiving pixels
+     * @param image: the decoded image
+     */
+    void push(Texture* texture, const ImageData& image);
+
+    /**
+     * Remove images waiting for a texture.
+     * @param texture: the texture
+     */
+    void cancel(Texture* texture);
+
+    /**
+     * Stage pixels until the budget of this frame runs out. It must be called on the main thread.
+     */
+    void update();
+
+    /**
+     * Set bytes staged in each frame.
+     * @param budget: bytes per frame
+     */
+    inline void setBudget(const size_t& budget) {
+        _budget = (budget == 0) ? DEFAULT_BUDGET : budget;
+    }
+
+    /**
+     * Get bytes staged in each frame.
+     * @return size_t, bytes per frame
+     */
+    inline size_t getBudget() const {
+        return _budget;
+    }
+
+    /**
+     * Get bytes waiting for staging.
+     * @return size_t, bytes in queue
+     */
+    size_t getBacklog() const;
+
+private:
+    /**
+     * Image waiting for staging.
+     */
+    struct Upload {
+        /**
+         * The texture receiving pixels
+         */
+        Texture* texture;
+
+        /**
+         * Decoded image
+         */
+        ImageData image;
+
+        /**
+         * Size of data in bytes
+         */
+        size_t size;
+
+        /**
+         * Bytes staged in pixel buffer
+         */
+        size_t staged;
+    };
+
+    /**
+     * Images waiting for staging
+     */
+    std::deque<Upload> _uploads;
+
+    /**
+     * Pixel buffer object
+     */
+    GLuint _buffer;
+
+    /**
+     * Bytes staged in each frame
+     */
+    size_t _budget;
+};
+
+} // namespace ngind::rendering
+
+#endif //NGIND_TEXTURE_UPLOAD_QUEUE_H
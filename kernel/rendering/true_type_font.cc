@@ -26,11 +26,12 @@
 #include <iostream>
 #include <algorithm>
 
+#include "distance_field.h"
 #include "log/logger_factory.h"
 
 namespace ngind::rendering {
 
-TrueTypeFont::TrueTypeFont() : _font_face(nullptr), _cache(), _max_height(0) {
+TrueTypeFont::TrueTypeFont() : _font_face(nullptr), _cache(), _w_cache(), _max_height(), _atlas() {
 }
 
 TrueTypeFont::~TrueTypeFont() {
@@ -41,71 +42,80 @@ TrueTypeFont::~TrueTypeFont() {
         logger->flush();
     }
 
-    for (const auto& [_, ch] : _cache) {
-        glDeleteTextures(1, &ch.texture);
-    }
-
-    for (const auto& [_, ch] : _w_cache) {
-        glDeleteTextures(1, &ch.texture);
-    }
-
     _cache.clear();
     _w_cache.clear();
 }
 
-Character TrueTypeFont::generateCharacterData(const char& c) {
-    if (_cache.find(c) == _cache.end()) {
-        FT_Select_Charmap(_font_face, FT_ENCODING_NONE);
-        FT_Set_Pixel_Sizes(_font_face, 0, DEFAULT_FONT_SIZE);
-        if (FT_Load_Char(_font_face, c, FT_LOAD_RENDER)) {
-            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
-            logger->log("Can't load true type font character.");
-            logger->flush();
-        }
+Character TrueTypeFont::generateCharacterData(const char& c, const size_t& size, const bool& sdf) {
+    auto raster_size = getRasterSize(size, sdf);
+    auto key = (static_cast<uint64_t>(static_cast<unsigned char>(c)) << 32) | getModeKey(raster_size, sdf);
+    auto it = _cache.find(key);
+    if (it == _cache.end()) {
+        it = _cache.emplace(key, load(static_cast<unsigned char>(c), FT_ENCODING_NONE, raster_size, sdf)).first;
+    }
 
-        _cache[c] = bind();
+    return it->second;
+}
+
+Character TrueTypeFont::generateCharacterData(const wchar_t& c, const size_t& size, const bool& sdf) {
+    auto raster_size = getRasterSize(size, sdf);
+    auto key = (static_cast<uint64_t>(c) << 32) | getModeKey(raster_size, sdf);
+    auto it = _w_cache.find(key);
+    if (it == _w_cache.end()) {
+        it = _w_cache.emplace(key, load(c, FT_ENCODING_UNICODE, raster_size, sdf)).first;
     }
 
-    return _cache[c];
+    return it->second;
 }
 
-Character TrueTypeFont::generateCharacterData(const wchar_t& c) {
-    if (_w_cache.find(c) == _w_cache.end()) {
-        FT_Select_Charmap(_font_face, FT_ENCODING_UNICODE);
-        FT_Set_Pixel_Sizes(_font_face, 0, DEFAULT_FONT_SIZE);
-        if (FT_Load_Char(_font_face, c, FT_LOAD_RENDER)) {
-            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
-            logger->log("Can't load true type font character.");
-            logger->flush();
-        }
+size_t TrueTypeFont::getRasterSize(const size_t& size, const bool& sdf) {
+    if (sdf) {
+        return DEFAULT_FONT_SIZE;
+    }
 
-        _w_cache[c] = bind();
+    for (const auto& bucket : SIZE_BUCKETS) {
+        if (bucket >= size) {
+            return bucket;
+        }
     }
 
-    return _w_cache[c];
+    return std::end(SIZE_BUCKETS)[-1];
 }
 
-Character TrueTypeFont::bind() {
-    Character character{};
-    glGenTextures(1, &character.texture);
-    glBindTexture(GL_TEXTURE_2D, character.texture);
-    character.size = {_font_face->glyph->bitmap.width, _font_face->glyph->bitmap.rows};
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED,
-                 character.size.x, character.size.y,
-                 0, GL_RED, GL_UNSIGNED_BYTE,
-                 _font_face->glyph->bitmap.buffer);
-
-    _max_height = std::max<unsigned int>(_max_height, _font_face->glyph->bitmap.rows);
+size_t TrueTypeFont::getMaxHeight(const size_t& size, const bool& sdf) const {
+    auto it = _max_height.find(getModeKey(getRasterSize(size, sdf), sdf));
+    return (it == _max_height.end()) ? 0 : it->second;
+}
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+Character TrueTypeFont::load(const FT_ULong& c, const FT_Encoding& encoding, const size_t& raster_size, const bool& sdf) {
+    FT_Select_Charmap(_font_face, encoding);
+    FT_Set_Pixel_Sizes(_font_face, 0, raster_size);
+    if (FT_Load_Char(_font_face, c, FT_LOAD_RENDER)) {
+        auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+        logger->log("Can't load true type font character.");
+        logger->flush();
+    }
 
+    const auto& bitmap = _font_face->glyph->bitmap;
+    Character character{};
+    character.size = {bitmap.width, bitmap.rows};
     character.bearing = {_font_face->glyph->bitmap_left, _font_face->glyph->bitmap_top};
     character.advance = {_font_face->glyph->advance.x, _font_face->glyph->advance.y};
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    auto& max_height = _max_height[getModeKey(raster_size, sdf)];
+    max_height = std::max<size_t>(max_height, bitmap.rows);
+
+    if (character.size.x > 0 && character.size.y > 0) {
+        if (sdf) {
+            auto field = DistanceField::generate(bitmap.buffer, character.size.x, character.size.y, SDF_SPREAD);
+            character.size += glm::ivec2{SDF_SPREAD * 2, SDF_SPREAD * 2};
+            character.bearing += glm::ivec2{-SDF_SPREAD, SDF_SPREAD};
+            _atlas.insert(character.size, field.data(), character);
+        }
+        else {
+            _atlas.insert(character.size, bitmap.buffer, character);
+        }
+    }
 
     return character;
 }
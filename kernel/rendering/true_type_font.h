@@ -26,21 +26,37 @@
 
 #include <string>
 #include <unordered_map>
+#include <cstdint>
 
 #include <freetype2/ft2build.h>
 #include FT_FREETYPE_H
 
 #include "character.h"
+#include "glyph_atlas.h"
 
 namespace ngind::rendering {
 
 /**
- * True type font(TTF) data.
+ * True type font(TTF) data. Glyphs are rasterized at a few size buckets, or once as
+ * signed distance fields which can be scaled to any size.
  */
 class TrueTypeFont {
 public:
+    /**
+     * Rasterization size of signed distance field glyphs.
+     */
     constexpr static size_t DEFAULT_FONT_SIZE = 48;
 
+    /**
+     * Distance in pixels covered by signed distance field around glyphs.
+     */
+    constexpr static int SDF_SPREAD = 6;
+
+    /**
+     * Rasterization sizes of ordinary glyphs. Text is drawn with the smallest one not less than its size.
+     */
+    constexpr static size_t SIZE_BUCKETS[] = {12, 16, 24, 32, 48, 64, 96, 128};
+
     TrueTypeFont();
 
     ~TrueTypeFont();
@@ -56,24 +72,46 @@ public:
     /**
      * Generate Character bitmap if it does not exist
      * @param c: the given character
+     * @param size: size of text
+     * @param sdf: true if signed distance field is used
      * @return Character, the bitmap and data of character
      */
-    Character generateCharacterData(const char& c);
+    Character generateCharacterData(const char& c, const size_t& size, const bool& sdf = false);
 
     /**
      * Generate UTF8 Character bitmap if it does not exist
      * @param c: the given character
+     * @param size: size of text
+     * @param sdf: true if signed distance field is used
      * @return Character, the bitmap and data of character
      */
-    Character generateCharacterData(const wchar_t& c);
+    Character generateCharacterData(const wchar_t& c, const size_t& size, const bool& sdf = false);
 
     /**
-     * Get the max height of all characters.
-     * @return size_t, the max height
+     * Get the size glyphs are rasterized at for text of given size.
+     * @param size: size of text
+     * @param sdf: true if signed distance field is used
+     * @return size_t, the rasterization size
+     */
+    static size_t getRasterSize(const size_t& size, const bool& sdf = false);
+
+    /**
+     * Get the scale from rasterized glyphs to text of given size.
+     * @param size: size of text
+     * @param sdf: true if signed distance field is used
+     * @return float, the scale
      */
-    inline size_t getMaxHeight() const {
-        return _max_height;
+    static inline float getScale(const size_t& size, const bool& sdf = false) {
+        return static_cast<float>(size) / getRasterSize(size, sdf);
     }
+
+    /**
+     * Get the max height of all characters rasterized at the same size as text of given size.
+     * @param size: size of text
+     * @param sdf: true if signed distance field is used
+     * @return size_t, the max height
+     */
+    size_t getMaxHeight(const size_t& size, const bool& sdf = false) const;
 private:
     /**
      * Font face data
@@ -81,27 +119,46 @@ private:
     FT_Face _font_face;
 
     /**
-     * ASCII characters cache.
+     * ASCII characters cache, keyed by character and rasterization mode.
      */
-    std::unordered_map<char, Character> _cache;
+    std::unordered_map<uint64_t, Character> _cache;
 
     /**
-     * UTF8 characters cache.
+     * UTF8 characters cache, keyed by character and rasterization mode.
      */
-    std::unordered_map<wchar_t, Character> _w_cache;
+    std::unordered_map<uint64_t, Character> _w_cache;
 
     /**
-     * Max height of all characters.
+     * Max height of characters for each rasterization mode.
      */
-    size_t _max_height;
+    std::unordered_map<uint64_t, size_t> _max_height;
+
+    /**
+     * Atlas holding bitmaps of all characters.
+     */
+    GlyphAtlas _atlas;
+
+    /**
+     * Get the cache key of rasterization mode.
+     * @param raster_size: rasterization size
+     * @param sdf: true if signed distance field is used
+     * @return uint64_t, the key
+     */
+    static inline uint64_t getModeKey(const size_t& raster_size, const bool& sdf) {
+        return (static_cast<uint64_t>(raster_size) << 1) | (sdf ? 1 : 0);
+    }
 
     /**
-     * Bind character data.
+     * Load and bind character data.
+     * @param c: character code
+     * @param encoding: encoding of character code
+     * @param raster_size: rasterization size
+     * @param sdf: true if signed distance field is used
      * @return The available character data.
      */
-    Character bind();
+    Character load(const FT_ULong& c, const FT_Encoding& encoding, const size_t& raster_size, const bool& sdf);
 };
 
 } // namespace ngind::rendering
 
-#endif //NGIND_TRUE_TYPE_FONT_H
+#endif //NGIND_TRUE_TYPE_FONT_H
\ No newline at end of file
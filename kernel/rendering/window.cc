@@ -33,11 +33,13 @@ namespace ngind::rendering {
 Window::Window(const size_t& width,
         const size_t& height,
         const std::string& title,
-        const bool& is_full) : _window(nullptr), _icon(nullptr), _is_full(is_full) {
+        const bool& is_full,
+        const bool& visible) : _window(nullptr), _icon(nullptr), _is_full(is_full) {
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
     glfwWindowHint(GLFW_SAMPLES, 4);
+    glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
 
     _width = width; _height = height;
 
@@ -55,6 +57,9 @@ Window::Window(const size_t& width,
     }
 
     glfwMakeContextCurrent(this->_window);
+    if (!visible) {
+        glfwSwapInterval(0);
+    }
     input::Input::getInstance()->setWindowHandler(this->_window);
 
     auto scale = getContentScale();
@@ -41,8 +41,10 @@ public:
      * @param height: height of window
      * @param title: title of window
      * @param is_full: true if window should be fullscreen and default is false
+     * @param visible: false if window is hidden and buffers are swapped without vertical sync
      */
-    Window(const size_t& width, const size_t& height, const std::string& title, const bool& is_full = false);
+    Window(const size_t& width, const size_t& height, const std::string& title, const bool& is_full = false,
+           const bool& visible = true);
 
     ~Window();
 
@@ -45,6 +45,15 @@ public:
      */
     virtual void load(const std::string& name) = 0;
 
+    /**
+     * Load resource without blocking. Resources that can't be loaded asynchronously
+     * are loaded by load.
+     * @param name: name of resource
+     */
+    virtual void loadAsync(const std::string& name) {
+        load(name);
+    }
+
     /**
      * Get path of resource.
      * @return std::string, path of resource
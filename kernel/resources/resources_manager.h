@@ -55,15 +55,18 @@ public:
      * Load resource by path.
      * @tparam Type: specific type of resource
      * @param path: the path of resource
+     * @param async: true if the resource is loaded without blocking
      * @return Type*, the resource object
      */
     template<typename Type, typename std::enable_if_t<std::is_base_of_v<Resource, Type>, int> N = 0>
-    Type* load(const std::string& path) {
+    Type* load(const std::string& path, const bool& async = false) {
         if (this->_resources.find(path) != this->_resources.end()) {
             this->_resources[path]->addReference();
             return static_cast<Type*>(this->_resources[path]);
         }
 
+        // resources are shared by worlds, so they never live in a world's arena.
+        memory::MemoryPool::ArenaScope scope{nullptr};
         this->_resources[path] = memory::MemoryPool::getInstance()->create<Type>();
         if (this->_resources[path] == nullptr) {
             auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
@@ -71,7 +74,12 @@ public:
             logger->flush();
         }
         else {
-            this->_resources[path]->load(path);
+            if (async) {
+                this->_resources[path]->loadAsync(path);
+            }
+            else {
+                this->_resources[path]->load(path);
+            }
             this->_resources[path]->addReference();
         }
 
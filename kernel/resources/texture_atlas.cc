@@ -0,0 +1,113 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file texture_atlas.cc
+
+
+#include "texture_atlas.h"
+
+#include <filesystem>
+
+#include "resources_manager.h"
+#include "config_resource.h"
+#include "settings.h"
+
+namespace ngind::resources {
+TextureAtlas* TextureAtlas::_instance = nullptr;
+
+TextureAtlas::TextureAtlas() : _pages(), _regions() {
+    loadIndex();
+}
+
+TextureAtlas* TextureAtlas::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new(std::nothrow) TextureAtlas();
+
+        if (_instance == nullptr) {
+            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+            logger->log("Can't create texture atlas instance.");
+            logger->flush();
+        }
+    }
+
+    return _instance;
+}
+
+void TextureAtlas::destroyInstance() {
+    if (_instance != nullptr) {
+        delete _instance;
+        _instance = nullptr;
+    }
+}
+
+bool TextureAtlas::find(const std::string& filename, Region& region) const {
+    auto it = _regions.find(filename);
+    if (it == _regions.end()) {
+        return false;
+    }
+
+    region = it->second;
+    return true;
+}
+
+void TextureAtlas::loadIndex() {
+    std::string filename = ATLAS_INDEX_FILENAME;
+    if constexpr (CURRENT_MODE == MODE_RELEASE) {
+        filename.replace(filename.length() - 4, 4, "cson");
+    }
+
+    if (!std::filesystem::exists(ConfigResource::CONFIG_RESOURCE_PATH + "/" + filename)) {
+        return;
+    }
+
+    auto config = ResourcesManager::getInstance()->load<ConfigResource>(ATLAS_INDEX_FILENAME);
+    try {
+        auto pages = (*config)["pages"].GetArray();
+        for (const auto& page : pages) {
+            _pages.emplace_back(page.GetString());
+        }
+
+        auto images = (*config)["images"].GetObject();
+        for (const auto& image : images) {
+            auto data = image.value.GetObject();
+            size_t page = data["page"].GetUint();
+            if (page >= _pages.size()) {
+                continue;
+            }
+
+            _regions[image.name.GetString()] = Region{_pages[page],
+                                                      glm::vec4{data["x"].GetFloat(), data["y"].GetFloat(),
+                                                                data["width"].GetFloat(), data["height"].GetFloat()}};
+        }
+    }
+    catch (...) {
+        auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+        logger->log("Can't read texture atlas index.");
+        logger->flush();
+        _regions.clear();
+    }
+
+    ResourcesManager::getInstance()->release(config);
+}
+
+} // namespace ngind::resources
@@ -0,0 +1,112 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file texture_atlas.h
+
+
+#ifndef NGIND_TEXTURE_ATLAS_H
+#define NGIND_TEXTURE_ATLAS_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "glm/glm.hpp"
+
+namespace ngind::resources {
+
+/**
+ * Index of images packed into atlas pages by the atlas tool. Images in the index are
+ * drawn from a sub-rectangle of the shared page texture, so that they can be batched.
+ */
+class TextureAtlas {
+public:
+    /**
+     * Name of the index file in configuration directory
+     */
+    constexpr static char ATLAS_INDEX_FILENAME[] = "atlas.json";
+
+    /**
+     * Location of an image in atlas pages.
+     */
+    struct Region {
+        /**
+         * Path of the page image
+         */
+        std::string page;
+
+        /**
+         * Sub-rectangle in pixels: (x, y, width, height), y goes down from the top of the page
+         */
+        glm::vec4 rect;
+    };
+
+    /**
+     * Get the instance of texture atlas. The index is read when it's called for the first time.
+     * @return TextureAtlas*, the instance
+     */
+    static TextureAtlas* getInstance();
+
+    /**
+     * Destroy the instance of texture atlas.
+     */
+    static void destroyInstance();
+
+    /**
+     * Find the region of an image.
+     * @param filename: the image's filename
+     * @param region: the region of image if found
+     * @return bool, true if the image is packed into atlas
+     */
+    bool find(const std::string& filename, Region& region) const;
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator= (const TextureAtlas&) = delete;
+private:
+    TextureAtlas();
+    ~TextureAtlas() = default;
+
+    /**
+     * The instance of texture atlas
+     */
+    static TextureAtlas* _instance;
+
+    /**
+     * Paths of pages
+     */
+    std::vector<std::string> _pages;
+
+    /**
+     * Regions of images, indexed by filename
+     */
+    std::unordered_map<std::string, Region> _regions;
+
+    /**
+     * Read the index file. Nothing happens if there is no index file.
+     */
+    void loadIndex();
+};
+
+} // namespace ngind::resources
+
+#endif //NGIND_TEXTURE_ATLAS_H
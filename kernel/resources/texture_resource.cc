@@ -23,32 +23,85 @@
 
 #include "texture_resource.h"
 
+#include <filesystem>
+
+#include "resources_manager.h"
+#include "texture_atlas.h"
+#include "rendering/texture_loader.h"
+#include "rendering/block_compression.h"
 #include "log/logger_factory.h"
 
 namespace ngind::resources {
 const std::string TextureResource::IMAGE_RESOURCE_PATH = "resources/images";
 
+TextureResource::~TextureResource() {
+    delete _texture;
+    _texture = nullptr;
+
+    if (_page != nullptr) {
+        ResourcesManager::getInstance()->release(_page);
+        _page = nullptr;
+    }
+}
+
 void TextureResource::load(const std::string& filename) {
+    loadTexture(filename, false);
+}
+
+void TextureResource::loadAsync(const std::string& filename) {
+    loadTexture(filename, true);
+}
+
+void TextureResource::loadTexture(const std::string& filename, const bool& async) {
     if (this->_texture != nullptr) {
         delete this->_texture;
         this->_texture = nullptr;
     }
 
+    if (this->_page != nullptr) {
+        ResourcesManager::getInstance()->release(this->_page);
+        this->_page = nullptr;
+    }
+
     this->_path = filename;
 
+    TextureAtlas::Region region;
+    if (TextureAtlas::getInstance()->find(filename, region)) {
+        _page = ResourcesManager::getInstance()->load<TextureResource>(region.page, async);
+        _texture = new rendering::Texture((*_page).operator->(), region.rect);
+        return;
+    }
+
     auto pos = filename.find_last_of('.');
     std::string ext = filename.substr(pos + 1);
 
+    rendering::TextureColorMode mode;
     if (ext == "png") {
-        _texture = new rendering::Texture(IMAGE_RESOURCE_PATH + "/" + filename, rendering::TextureColorMode::MODE_RGBA);
+        mode = rendering::TextureColorMode::MODE_RGBA;
     }
     else if (ext == "jpg") {
-        _texture = new rendering::Texture(IMAGE_RESOURCE_PATH + "/" + filename, rendering::TextureColorMode::MODE_RGB);
+        mode = rendering::TextureColorMode::MODE_RGB;
     }
     else {
         auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
         logger->log("Unsupported texture format.");
         logger->flush();
+        return;
+    }
+
+    // prefer block compressed texture produced by texcompress tool
+    std::string path = IMAGE_RESOURCE_PATH + "/" + filename;
+    std::string compressed = path.substr(0, path.find_last_of('.') + 1) + rendering::BlockCompression::EXTENSION;
+    if (std::filesystem::exists(compressed)) {
+        path = compressed;
+    }
+
+    if (async) {
+        _texture = new rendering::Texture(mode);
+        rendering::TextureLoader::getInstance()->load(_texture, path, mode);
+    }
+    else {
+        _texture = new rendering::Texture(path, mode);
     }
 }
 } // namespace ngind::resources
\ No newline at end of file
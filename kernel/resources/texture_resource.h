@@ -39,14 +39,21 @@ class TextureResource : public Resource {
 public:
     const static std::string IMAGE_RESOURCE_PATH;
 
-    TextureResource() : Resource(), _texture(nullptr) {};
-    ~TextureResource() override = default;
+    TextureResource() : Resource(), _texture(nullptr), _page(nullptr) {};
+    ~TextureResource() override;
 
     /**
      * @see kernel/resources/resource.h
      */
     void load(const std::string&) override;
 
+    /**
+     * Decode the image on worker threads. The texture shows a transparent placeholder until
+     * pixels are uploaded.
+     * @see kernel/resources/resource.h
+     */
+    void loadAsync(const std::string&) override;
+
     /**
      * Get texture object.
      * @return rendering::Texture*, texture object
@@ -60,6 +67,18 @@ private:
      * Texture pointer.
      */
     rendering::Texture* _texture;
+
+    /**
+     * Atlas page this texture lives in, or nullptr if it's a standalone image.
+     */
+    TextureResource* _page;
+
+    /**
+     * Load texture of an image, or the atlas page containing it.
+     * @param filename: the image's filename
+     * @param async: true if the image is decoded on worker threads
+     */
+    void loadTexture(const std::string& filename, const bool& async);
 };
 
 } // namespace ngind::resources
@@ -28,6 +28,7 @@
 #include "components/state_machine.h"
 #include "math/random.h"
 #include "log/logger_factory.h"
+#include "timer/profiler.h"
 
 namespace ngind::script {
 Observer* Observer::_instance = nullptr;
@@ -138,6 +139,7 @@ sender(script::LuaState::getInstance()->getState()), data(d), object(obj), all(f
 }
 
 void Observer::update() {
+    NGIND_PROFILE_ZONE("Observer::update");
     while (!_queue.empty()) {
         auto pack = _queue.front();
         _queue.pop();
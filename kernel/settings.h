@@ -30,6 +30,17 @@ static constexpr short MODE_DEBUG = 0;
 static constexpr short MODE_RELEASE = 1;
 static constexpr short CURRENT_MODE = MODE_DEBUG;
 
+/**
+ * Set to 0 to compile profiler zones out.
+ */
+#define NGIND_PROFILER 1
+
+/**
+ * Set to 1 to allow creating and releasing auto collection objects on any thread. Reference
+ * counts become atomic and objects are collected on the main thread. It costs nothing if it's 0.
+ */
+#define NGIND_THREAD_SAFE_MEMORY 0
+
 } // namespace ngind
 
 #endif //NGIND_SETTINGS_H
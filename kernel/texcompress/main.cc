@@ -0,0 +1,70 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file main.cc
+
+
+#include <cstdio>
+#include <string>
+
+#include "SOIL2/SOIL2.h"
+#include "rendering/block_compression.h"
+
+/**
+ * Compress an image into a block compressed texture.
+ * Usage: texcompress <input image> <output file>
+ * PNG images are compressed to DXT5 keeping alpha, and others to DXT1. Put the output
+ * next to the image with extension ngtc and the engine loads it instead of the image.
+ */
+int main(int argc, char* argv[]) {
+    using ngind::rendering::BlockCompression;
+    if (argc != 3) {
+        printf("usage: texcompress <input image> <output file>\n");
+        return 0;
+    }
+
+    std::string in = argv[1], out = argv[2];
+    auto format = (in.substr(in.find_last_of('.') + 1) == "png") ?
+            BlockCompression::FORMAT_DXT5 : BlockCompression::FORMAT_DXT1;
+
+    int width = 0, height = 0;
+    unsigned char* pixels = SOIL_load_image(in.c_str(), &width, &height, nullptr, SOIL_LOAD_RGBA);
+    if (pixels == nullptr) {
+        printf("can't load %s\n", in.c_str());
+        return -1;
+    }
+
+    std::string res = BlockCompression::encode(pixels, width, height, format);
+    SOIL_free_image_data(pixels);
+
+    FILE* fp = fopen(out.c_str(), "wb");
+    if (fp == nullptr) {
+        printf("can't write %s\n", out.c_str());
+        return -1;
+    }
+
+    fwrite(res.data(), 1, res.size(), fp);
+    fclose(fp);
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file frame_statistics.cc
+
+
+#include "frame_statistics.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+#include "log/logger_factory.h"
+
+namespace ngind::timer {
+
+FrameStatistics::FrameStatistics(const size_t& capacity) : _hash(14695981039346656037ULL), _hashed(false) {
+    _times.reserve(capacity);
+}
+
+void FrameStatistics::record(const double& seconds) {
+    _times.push_back(seconds);
+}
+
+void FrameStatistics::addHash(const uint64_t& hash) {
+    _hash = (_hash ^ hash) * 1099511628211ULL;
+    _hashed = true;
+}
+
+void FrameStatistics::report(const std::string& filename) const {
+    auto logger = log::LoggerFactory::getInstance()->getLogger(filename, log::LogLevel::LOG_LEVEL_INFO);
+    if (_times.empty()) {
+        logger->log("No frame recorded.");
+        logger->flush();
+        return;
+    }
+
+    auto sorted = _times;
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&sorted](const double& p) {
+        auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[index] * 1000.0;
+    };
+
+    double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size()) * 1000.0;
+
+    std::stringstream stream;
+    stream << "frames: " << sorted.size()
+           << ", mean: " << mean << "ms"
+           << ", min: " << sorted.front() * 1000.0 << "ms"
+           << ", max: " << sorted.back() * 1000.0 << "ms"
+           << ", p50: " << percentile(0.5) << "ms"
+           << ", p95: " << percentile(0.95) << "ms"
+           << ", p99: " << percentile(0.99) << "ms";
+    if (_hashed) {
+        stream << ", hash: " << std::hex << _hash;
+    }
+
+    logger->log(stream.str());
+    logger->flush();
+}
+
+} // namespace ngind::timer
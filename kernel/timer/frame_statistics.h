@@ -0,0 +1,93 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file frame_statistics.h
+
+
+#ifndef NGIND_FRAME_STATISTICS_H
+#define NGIND_FRAME_STATISTICS_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace ngind::timer {
+
+/**
+ * Collector of frame times and frame hashes, used by benchmarks running in headless mode.
+ */
+class FrameStatistics {
+public:
+    /**
+     * @param capacity: number of frames expected
+     */
+    explicit FrameStatistics(const size_t& capacity);
+
+    ~FrameStatistics() = default;
+
+    /**
+     * Record time used by a frame.
+     * @param seconds: time used in second
+     */
+    void record(const double& seconds);
+
+    /**
+     * Fold the hash of a frame into the hash of whole run.
+     * @param hash: hash of frame
+     */
+    void addHash(const uint64_t& hash);
+
+    /**
+     * Get the number of frames recorded.
+     * @return size_t, number of frames
+     */
+    inline size_t getFramesNumber() const {
+        return _times.size();
+    }
+
+    /**
+     * Write frame count, mean, min, max and percentiles of frame times into a log file.
+     * @param filename: name of log file
+     */
+    void report(const std::string& filename) const;
+
+private:
+    /**
+     * Frame times in second
+     */
+    std::vector<double> _times;
+
+    /**
+     * Hash of all frames
+     */
+    uint64_t _hash;
+
+    /**
+     * True if any frame has been hashed
+     */
+    bool _hashed;
+};
+
+} // namespace ngind::timer
+
+#endif //NGIND_FRAME_STATISTICS_H
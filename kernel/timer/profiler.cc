@@ -0,0 +1,169 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file profiler.cc
+
+
+#include "profiler.h"
+
+#include <algorithm>
+
+#include "filesystem/file_output_stream.h"
+#include "log/logger_factory.h"
+
+namespace ngind::timer {
+Profiler* Profiler::_instance = nullptr;
+thread_local Profiler::ThreadZones* Profiler::_local = nullptr;
+thread_local const Profiler* Profiler::_local_owner = nullptr;
+
+Profiler::Profiler() : _origin(clock_type::now()), _counters(COUNTERS_CAPACITY), _counters_count(0),
+    _frames{}, _frames_count(0) {
+}
+
+Profiler::~Profiler() {
+    for (auto zones : _threads) {
+        delete zones;
+    }
+
+    _threads.clear();
+}
+
+Profiler* Profiler::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new(std::nothrow) Profiler();
+        if (_instance == nullptr) {
+            auto logger = log::LoggerFactory::getInstance()->getLogger("crash.log", log::LogLevel::LOG_LEVEL_ERROR);
+            logger->log("Can't create profiler.");
+            logger->flush();
+        }
+    }
+
+    return _instance;
+}
+
+void Profiler::destroyInstance() {
+    if (_instance != nullptr) {
+        delete _instance;
+        _instance = nullptr;
+    }
+}
+
+Profiler::ThreadZones* Profiler::getLocalZones() {
+    if (_local == nullptr || _local_owner != this) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _local_owner = this;
+        _local = new ThreadZones();
+        _local->id = _threads.size();
+        _local->zones.resize(ZONES_CAPACITY);
+        _local->count = 0;
+        _threads.push_back(_local);
+    }
+
+    return _local;
+}
+
+void Profiler::record(const char* name, const clock_type::time_point& start, const clock_type::time_point& end) {
+    auto zones = getLocalZones();
+    auto count = zones->count.load(std::memory_order_relaxed);
+    auto& zone = zones->zones[count % ZONES_CAPACITY];
+    zone.name = name;
+    zone.start = std::chrono::duration_cast<std::chrono::microseconds>(start - _origin).count();
+    zone.duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    zones->count.store(count + 1, std::memory_order_release);
+}
+
+void Profiler::counter(const std::string& name, const float& value) {
+    auto& sample = _counters[_counters_count % COUNTERS_CAPACITY];
+    sample.name = name;
+    sample.time = std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - _origin).count();
+    sample.value = value;
+    _counters_count++;
+}
+
+void Profiler::endFrame(const float& seconds) {
+    _frames[_frames_count % FRAMES_CAPACITY] = seconds;
+    _frames_count++;
+}
+
+std::string Profiler::getFrameGraph() const {
+    static const char LEVELS[] = " .:-=+*#%@";
+    static constexpr size_t LEVELS_NUMBER = sizeof(LEVELS) - 2;
+
+    auto number = std::min(_frames_count, FRAMES_CAPACITY);
+    auto first = _frames_count - number;
+    float max = 0.0f;
+    for (size_t i = first; i < _frames_count; i++) {
+        max = std::max(max, _frames[i % FRAMES_CAPACITY]);
+    }
+
+    std::string graph;
+    graph.reserve(number);
+    for (size_t i = first; i < _frames_count; i++) {
+        auto level = (max > 0.0f) ? static_cast<size_t>(_frames[i % FRAMES_CAPACITY] / max * LEVELS_NUMBER) : 0;
+        graph.push_back(LEVELS[level]);
+    }
+
+    return graph;
+}
+
+void Profiler::dump(const std::string& filename) {
+    filesystem::FileOutputStream stream{filename};
+    stream.write("{\"traceEvents\":[");
+
+    bool first = true;
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (auto zones : _threads) {
+        auto count = zones->count.load(std::memory_order_acquire);
+        auto begin = (count > ZONES_CAPACITY) ? count - ZONES_CAPACITY : 0;
+        for (auto i = begin; i < count; i++) {
+            const auto& zone = zones->zones[i % ZONES_CAPACITY];
+            if (!first) {
+                stream.write(",");
+            }
+
+            stream.write("\n{\"name\":\"" + std::string{zone.name} +
+                         "\",\"cat\":\"ngind\",\"ph\":\"X\",\"ts\":" + std::to_string(zone.start) +
+                         ",\"dur\":" + std::to_string(zone.duration) +
+                         ",\"pid\":0,\"tid\":" + std::to_string(zones->id) + "}");
+            first = false;
+        }
+    }
+
+    auto begin = (_counters_count > COUNTERS_CAPACITY) ? _counters_count - COUNTERS_CAPACITY : 0;
+    for (auto i = begin; i < _counters_count; i++) {
+        const auto& sample = _counters[i % COUNTERS_CAPACITY];
+        if (!first) {
+            stream.write(",");
+        }
+
+        stream.write("\n{\"name\":\"" + sample.name +
+                     "\",\"cat\":\"ngind\",\"ph\":\"C\",\"ts\":" + std::to_string(sample.time) +
+                     ",\"pid\":0,\"args\":{\"value\":" + std::to_string(sample.value) + "}}");
+        first = false;
+    }
+
+    stream.write("\n]}");
+    stream.close();
+}
+
+} // namespace ngind::timer
@@ -0,0 +1,275 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file profiler.h
+
+
+#ifndef NGIND_PROFILER_H
+#define NGIND_PROFILER_H
+
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "settings.h"
+
+namespace ngind::timer {
+
+/**
+ * Collector of timing zones. Each thread writes its zones into its own ring buffer,
+ * so recording a zone never takes a lock. Zones can be exported as a Chrome trace file
+ * (open it in chrome://tracing or Perfetto).
+ */
+class Profiler {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    /**
+     * Number of zones kept in each thread
+     */
+    static constexpr size_t ZONES_CAPACITY = 16384;
+
+    /**
+     * Number of counter samples kept
+     */
+    static constexpr size_t COUNTERS_CAPACITY = 4096;
+
+    /**
+     * Number of frames kept in frame time history
+     */
+    static constexpr size_t FRAMES_CAPACITY = 64;
+
+    /**
+     * A finished timing zone.
+     */
+    struct Zone {
+        /**
+         * Name of zone. It must be a string literal
+         */
+        const char* name;
+
+        /**
+         * Start time in microsecond since profiler was created
+         */
+        int64_t start;
+
+        /**
+         * Duration in microsecond
+         */
+        int64_t duration;
+    };
+
+    /**
+     * Get the unique instance of class. If it does not exist, this function will create one.
+     * @return Profiler*, the unique instance
+     */
+    static Profiler* getInstance();
+
+    /**
+     * Destroy the instance if it exists.
+     */
+    static void destroyInstance();
+
+    /**
+     * Record a finished zone in current thread.
+     * @param name: name of zone, which must be a string literal
+     * @param start: start time point
+     * @param end: end time point
+     */
+    void record(const char* name, const clock_type::time_point& start, const clock_type::time_point& end);
+
+    /**
+     * Record a sample of a counter, e.g. GPU time of a rendering pass. It's called on the main thread.
+     * @param name: name of counter
+     * @param value: value of sample
+     */
+    void counter(const std::string& name, const float& value);
+
+    /**
+     * Record time used by a frame. It's called once per frame on the main thread.
+     * @param seconds: time used in second
+     */
+    void endFrame(const float& seconds);
+
+    /**
+     * Draw recent frame times as a text graph, one character for each frame.
+     * @return std::string, the graph
+     */
+    std::string getFrameGraph() const;
+
+    /**
+     * Write zones kept in all threads into a Chrome trace event file.
+     * @param filename: name of trace file
+     */
+    void dump(const std::string& filename);
+
+private:
+    Profiler();
+    ~Profiler();
+
+    /**
+     * Ring buffer of zones written by one thread.
+     */
+    struct ThreadZones {
+        /**
+         * Index of thread in trace
+         */
+        size_t id;
+
+        /**
+         * Zones recorded
+         */
+        std::vector<Zone> zones;
+
+        /**
+         * Number of zones ever recorded
+         */
+        std::atomic<size_t> count;
+    };
+
+    /**
+     * The unique instance
+     */
+    static Profiler* _instance;
+
+    /**
+     * Zones of current thread
+     */
+    static thread_local ThreadZones* _local;
+
+    /**
+     * Instance that zones of current thread belong to. Zones are recreated if the
+     * profiler has been destroyed and created again.
+     */
+    static thread_local const Profiler* _local_owner;
+
+    /**
+     * Time point when profiler was created
+     */
+    clock_type::time_point _origin;
+
+    /**
+     * Zones of all threads
+     */
+    std::vector<ThreadZones*> _threads;
+
+    /**
+     * Mutex for threads list
+     */
+    std::mutex _mutex;
+
+    /**
+     * A sample of counter.
+     */
+    struct Counter {
+        /**
+         * Name of counter
+         */
+        std::string name;
+
+        /**
+         * Sample time in microsecond since profiler was created
+         */
+        int64_t time;
+
+        /**
+         * Value of sample
+         */
+        float value;
+    };
+
+    /**
+     * Recent counter samples
+     */
+    std::vector<Counter> _counters;
+
+    /**
+     * Number of counter samples ever recorded
+     */
+    size_t _counters_count;
+
+    /**
+     * Recent frame times in second
+     */
+    float _frames[FRAMES_CAPACITY];
+
+    /**
+     * Number of frames ever recorded
+     */
+    size_t _frames_count;
+
+    /**
+     * Get zones of current thread, and create them at first call.
+     * @return ThreadZones*, zones of current thread
+     */
+    ThreadZones* getLocalZones();
+};
+
+/**
+ * Timing zone which records the time between its construction and destruction.
+ */
+class ProfileScope {
+public:
+    /**
+     * @param name: name of zone, which must be a string literal
+     */
+    explicit ProfileScope(const char* name) : _name(name), _start(Profiler::clock_type::now()) {
+    }
+
+    ~ProfileScope() {
+        Profiler::getInstance()->record(_name, _start, Profiler::clock_type::now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator= (const ProfileScope&) = delete;
+private:
+    /**
+     * Name of zone
+     */
+    const char* _name;
+
+    /**
+     * Start time point
+     */
+    Profiler::clock_type::time_point _start;
+};
+
+} // namespace ngind::timer
+
+#define __NGIND_PROFILE_CAT(__X__, __Y__) __X__##__Y__
+#define NGIND_PROFILE_CAT(__X__, __Y__) __NGIND_PROFILE_CAT(__X__, __Y__)
+
+/**
+ * Macro for timing the rest of current scope. It's compiled out unless NGIND_PROFILER is 1.
+ */
+#if NGIND_PROFILER
+#define NGIND_PROFILE_ZONE(__NAME__) \
+ngind::timer::ProfileScope NGIND_PROFILE_CAT(__profile_zone__, __LINE__) {__NAME__}
+#else
+#define NGIND_PROFILE_ZONE(__NAME__)
+#endif
+
+#endif //NGIND_PROFILER_H
@@ -49,7 +49,17 @@ void Timer::sleep(const float& sec) {
         return;
     }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds (static_cast<long>(sec * 1000.0f)));
+    // sleeping is only as precise as the scheduler, so wake up a little earlier and spin for the rest.
+    auto deadline = getNow() + std::chrono::duration_cast<time_type::duration>(std::chrono::duration<float>(sec));
+    auto coarse = std::chrono::duration<float>(sec) - SPIN_DURATION;
+    if (coarse.count() > 0.0f) {
+        std::this_thread::sleep_for(coarse);
+    }
+
+    while (getNow() < deadline) {
+        std::this_thread::yield();
+    }
+
     _previous = getNow();
 }
 
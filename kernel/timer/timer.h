@@ -36,6 +36,11 @@ class Timer {
 public:
     using time_type = std::chrono::time_point<std::chrono::system_clock>;
 
+    /**
+     * Time spent spinning at the end of sleep instead of sleeping
+     */
+    static constexpr std::chrono::duration<float> SPIN_DURATION{0.002f};
+
     /**
      * @param scale: scale of time speed.
      */
@@ -54,7 +59,8 @@ public:
     void resume();
 
     /**
-     * Sleep for a while and block current thread.
+     * Sleep for a while and block current thread. It sleeps most of the time and spins
+     * for the rest, so it wakes up on time.
      * @param sec: time to sleep in second
      */
     void sleep(const float& sec);
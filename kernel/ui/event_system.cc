@@ -30,6 +30,7 @@
 #include "script/observer.h"
 #include "script/lua_state.h"
 #include "log/logger_factory.h"
+#include "timer/profiler.h"
 
 namespace ngind::ui {
 EventSystem* EventSystem::_instance = nullptr;
@@ -65,6 +66,7 @@ void EventSystem::destroyInstance() {
 }
 
 void EventSystem::update() {
+    NGIND_PROFILE_ZONE("EventSystem::update");
     if (_tree == nullptr) {
         return;
     }
@@ -0,0 +1,107 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file color_markup.cc
+
+#include "color_markup.h"
+
+namespace ngind::utils {
+
+void ColorMarkup::parse(const std::string& text) {
+    constexpr size_t BEGIN_LENGTH = sizeof(COLOR_TAG_BEGIN) - 1 + 9, END_LENGTH = sizeof(COLOR_TAG_END) - 1;
+
+    _segments.clear();
+    _stack.clear();
+    _plain_text.clear();
+    _plain_text.reserve(text.length());
+
+    unsigned int count = 0, begin = 0; // positions are counted in characters rather than bytes
+    auto closeSegment = [&]() {
+        if (!_stack.empty() && count > begin) {
+            _segments.push_back(Segment{_stack.back(), begin, count});
+        }
+        begin = count;
+    };
+
+    for (size_t i = 0; i < text.length();) {
+        auto c = text[i];
+        if (c == '\\' && i + 1 < text.length() && (text[i + 1] == '<' || text[i + 1] == '\\')) {
+            c = text[i + 1];
+            i++;
+        }
+        else if (c == '<') {
+            unsigned int color = 0;
+            if (parseColorTag(text, i, color)) {
+                closeSegment();
+                _stack.push_back(color);
+                i += BEGIN_LENGTH;
+                continue;
+            }
+            if (!_stack.empty() && text.compare(i, END_LENGTH, COLOR_TAG_END) == 0) {
+                closeSegment();
+                _stack.pop_back();
+                i += END_LENGTH;
+                continue;
+            }
+        }
+
+        _plain_text.push_back(c);
+        if ((c & 0xC0) != 0x80) {
+            count++;
+        }
+        i++;
+    }
+
+    closeSegment();
+}
+
+bool ColorMarkup::parseColorTag(const std::string& text, const size_t& pos, unsigned int& color) {
+    constexpr size_t PREFIX_LENGTH = sizeof(COLOR_TAG_BEGIN) - 1;
+    if (text.compare(pos, PREFIX_LENGTH, COLOR_TAG_BEGIN) != 0 || pos + PREFIX_LENGTH + 9 > text.length() ||
+        text[pos + PREFIX_LENGTH + 8] != '>') {
+        return false;
+    }
+
+    unsigned int value = 0;
+    for (size_t i = pos + PREFIX_LENGTH; i < pos + PREFIX_LENGTH + 8; i++) {
+        auto ch = text[i];
+        value <<= 4;
+        if (ch >= '0' && ch <= '9') {
+            value += ch - '0';
+        }
+        else if (ch >= 'A' && ch <= 'F') {
+            value += ch - 'A' + 10;
+        }
+        else if (ch >= 'a' && ch <= 'f') {
+            value += ch - 'a' + 10;
+        }
+        else {
+            return false;
+        }
+    }
+
+    color = value;
+    return true;
+}
+
+} // namespace ngind::utils
@@ -0,0 +1,124 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file color_markup.h
+
+#ifndef NGIND_COLOR_MARKUP_H
+#define NGIND_COLOR_MARKUP_H
+
+#include <string>
+#include <vector>
+
+namespace ngind::utils {
+
+/**
+ * Parser of color markup in text: <color=#RRGGBBAA>text</color>. Tags can be nested,
+ * and \< and \\ are escapes of < and \.
+ */
+class ColorMarkup {
+public:
+    /**
+     * Characters in plain text using the same color.
+     */
+    struct Segment {
+        /**
+         * Color in RGBA form, 8 bits for each channel
+         */
+        unsigned int color;
+
+        /**
+         * First character of segment
+         */
+        unsigned int begin;
+
+        /**
+         * Character after the last one of segment
+         */
+        unsigned int end;
+    };
+
+    ColorMarkup() = default;
+    ~ColorMarkup() = default;
+
+    /**
+     * Remove all color tags in a single pass, and record the colors of segments. Positions of
+     * segments are counted in characters rather than bytes, so UTF-8 text is supported.
+     * @param text: text with color markup
+     */
+    void parse(const std::string& text);
+
+    /**
+     * Get text without color markup.
+     * @return const std::string&, the plain text
+     */
+    inline const std::string& getPlainText() const {
+        return _plain_text;
+    }
+
+    /**
+     * Get colored segments of plain text in order. Characters out of them have no markup color.
+     * @return const std::vector<Segment>&, the segments
+     */
+    inline const std::vector<Segment>& getSegments() const {
+        return _segments;
+    }
+
+private:
+    /**
+     * Prefix of opening color tag, followed by 8 hex digits and ">"
+     */
+    constexpr static char COLOR_TAG_BEGIN[] = "<color=#";
+
+    /**
+     * Closing color tag
+     */
+    constexpr static char COLOR_TAG_END[] = "</color>";
+
+    /**
+     * Text without color markup
+     */
+    std::string _plain_text;
+
+    /**
+     * Colored segments of plain text
+     */
+    std::vector<Segment> _segments;
+
+    /**
+     * Colors of unclosed tags when parsing markup
+     */
+    std::vector<unsigned int> _stack;
+
+    /**
+     * Parse an opening color tag.
+     * @param text: text with color markup
+     * @param pos: position of the tag in text
+     * @param color: the color in the tag
+     * @return bool, true if there is a valid opening tag
+     */
+    static bool parseColorTag(const std::string& text, const size_t& pos, unsigned int& color);
+};
+
+} // namespace ngind::utils
+
+#endif //NGIND_COLOR_MARKUP_H
@@ -0,0 +1,118 @@
+/**
+ * @copybrief
+ * MIT License
+ * Copyright (c) 2020 NeilKleistGao
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// @file thread_pool.h
+
+
+#ifndef NGIND_THREAD_POOL_H
+#define NGIND_THREAD_POOL_H
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace ngind::utils {
+
+/**
+ * A fixed set of worker threads running tasks posted from any thread. Tasks must not
+ * touch OpenGL or other main-thread-only state.
+ */
+class ThreadPool {
+public:
+    /**
+     * Get the instance of thread pool. Workers are created when it's called for the first time.
+     * @return ThreadPool*, the instance
+     */
+    static ThreadPool* getInstance();
+
+    /**
+     * Destroy the instance of thread pool. Tasks in queue are finished before workers exit.
+     */
+    static void destroyInstance();
+
+    /**
+     * Post a task to be run on a worker thread.
+     * @param task: the task
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * Get the number of worker threads.
+     * @return size_t, the number of threads
+     */
+    inline size_t getThreadsNumber() const {
+        return _workers.size();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator= (const ThreadPool&) = delete;
+private:
+    /**
+     * @param size: the number of worker threads
+     */
+    explicit ThreadPool(const size_t& size);
+
+    ~ThreadPool();
+
+    /**
+     * The instance of thread pool
+     */
+    static ThreadPool* _instance;
+
+    /**
+     * Worker threads
+     */
+    std::vector<std::thread> _workers;
+
+    /**
+     * Tasks waiting for workers
+     */
+    std::queue<std::function<void()>> _tasks;
+
+    /**
+     * Mutex protecting task queue
+     */
+    std::mutex _mutex;
+
+    /**
+     * Condition notified when tasks are posted or pool is stopping
+     */
+    std::condition_variable _condition;
+
+    /**
+     * True if workers should exit
+     */
+    bool _stop;
+
+    /**
+     * Loop of worker threads.
+     */
+    void work();
+};
+
+} // namespace ngind::utils
+
+#endif //NGIND_THREAD_POOL_H
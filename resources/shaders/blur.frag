@@ -0,0 +1,18 @@
+#version 330 core
+in vec2 TexCoord;
+
+out vec4 color;
+
+uniform sampler2D image;
+uniform vec2 texel;
+
+void main() {
+    vec4 sum = vec4(0.0);
+    for (int x = -1; x <= 1; x++) {
+        for (int y = -1; y <= 1; y++) {
+            sum += texture(image, TexCoord + vec2(x, y) * texel);
+        }
+    }
+
+    color = sum / 9.0;
+}
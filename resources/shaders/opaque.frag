@@ -1,12 +1,12 @@
 #version 330 core
 in vec2 TexCoord;
+in vec4 VertexColor;
 
 out vec4 color;
 
 uniform sampler2D image;
-uniform vec4 my_color;
 uniform float opaque;
 
 void main() {
-    color = opaque * my_color * texture(image, TexCoord);
+    color = opaque * VertexColor * texture(image, TexCoord);
 }
\ No newline at end of file
@@ -0,0 +1,11 @@
+#version 330 core
+in vec2 TexCoord;
+
+out vec4 color;
+
+uniform sampler2D image;
+uniform float brightness;
+
+void main() {
+    color = vec4(texture(image, TexCoord).rgb * brightness, 1.0);
+}
@@ -0,0 +1,17 @@
+#version 330 core
+layout (location = 0) in vec2 corner;
+layout (location = 2) in mat4 model;
+layout (location = 6) in vec4 uv_rect;
+layout (location = 7) in vec4 instance_color;
+out vec2 TexCoord;
+out vec4 VertexColor;
+
+layout (std140) uniform Frame {
+    mat4 projection;
+};
+
+void main() {
+    TexCoord = mix(uv_rect.xy, uv_rect.zw, corner);
+    VertexColor = instance_color;
+    gl_Position = projection * model * vec4(corner, 0.0, 1.0);
+}
\ No newline at end of file
@@ -1,11 +1,15 @@
 #version 330 core
 layout (location = 0) in vec4 vertex;
+layout (location = 1) in vec4 vertex_color;
 out vec2 texCoords;
+out vec4 vertexColor;
 
-uniform mat4 model;
-uniform mat4 projection;
+layout (std140) uniform Frame {
+    mat4 projection;
+};
 
 void main() {
-    gl_Position = projection * model * vec4(vertex.xy, 0.0, 1.0);
+    gl_Position = projection * vec4(vertex.xy, 0.0, 1.0);
     texCoords = vertex.zw;
+    vertexColor = vertex_color;
 }
\ No newline at end of file
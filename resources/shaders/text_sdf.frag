@@ -0,0 +1,13 @@
+#version 330 core
+in vec2 texCoords;
+in vec4 vertexColor;
+out vec4 color;
+
+uniform sampler2D text;
+
+void main() {
+    float distance = texture(text, texCoords).r;
+    float width = fwidth(distance);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+    color = vec4(vertexColor.rgb, vertexColor.a * alpha);
+}
@@ -3,6 +3,7 @@
 echo "Change build mode..."
 sed -i "s/static constexpr short CURRENT_MODE = MODE_DEBUG;/static constexpr short CURRENT_MODE = MODE_RELEASE;/g" "../kernel/settings.h"
 sed -i "s/if (0)/if (1)/g" "../CMakeLists.txt"
+sed -i "s/#define NGIND_PROFILER 1/#define NGIND_PROFILER 0/g" "../kernel/settings.h"
 cd ..
 
 if  [ ! -d "build" ]; then
@@ -12,6 +13,19 @@ fi
 cmake --build cmake-build-debug --target all -- -j6
 make
 
+echo "Pack images into atlas..."
+build/atlas ./build/resources/images ./build/resources/config/atlas.json
+
+for file in `find ./build/resources -name "*.png" -o -name "*.jpg"`
+do
+    echo "texture compress ${file}..."
+    `build/texcompress ${file} ${file: 0:${#file} - 4}".ngtc"`
+    # the engine always prefers the .ngtc, so don't ship the image as well
+    if [ -f ${file: 0:${#file} - 4}".ngtc" ]; then
+        rm ${file}
+    fi
+done
+
 for file in `find ./build/resources -name "*.lua"`
 do
     echo "encrypt ${file}..."
@@ -63,7 +77,13 @@ done
 
 rm "build/crypto"
 rm "build/compress"
+rm "build/texcompress"
+rm "build/atlas"
+rm "build/markup_benchmark"
+rm "build/rendering_queue_benchmark"
+rm "build/slab_allocator_benchmark"
 
 cd tools
 sed -i "s/if (1)/if (0)/g" "../CMakeLists.txt"
+sed -i "s/#define NGIND_PROFILER 0/#define NGIND_PROFILER 1/g" "../kernel/settings.h"
 sed -i "s/static constexpr short CURRENT_MODE = MODE_RELEASE;/static constexpr short CURRENT_MODE = MODE_DEBUG;/g" "../kernel/settings.h"
\ No newline at end of file